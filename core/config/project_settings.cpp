@@ -1882,6 +1882,8 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_high_priority_threads", true);
 
 	GLOBAL_DEF("navigation/pathfinding/max_threads", 4);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/pathfinding/async_query_time_budget_msec", PROPERTY_HINT_RANGE, "0,100,0.01,or_greater,suffix:ms"), 2.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/pathfinding/path_corridor_cache_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
 
 	GLOBAL_DEF("navigation/baking/use_crash_prevention_checks", true);
 	GLOBAL_DEF("navigation/baking/thread_model/baking_use_multiple_threads", true);
@@ -37,6 +37,7 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
@@ -518,67 +519,108 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Pixel kernels below process independent rows, so large images are split in contiguous row ranges
+// and dispatched to the WorkerThreadPool. Every row is computed by the exact same code regardless of
+// how it was scheduled, so the output is bit-identical to a serial run.
+static constexpr uint64_t IMAGE_PARALLEL_MIN_WORK = 1 << 16;
+
+template <typename F>
+static void _image_process_rows(uint32_t p_rows, uint64_t p_work_per_row, const F &p_func) {
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	// Waiting on a group from a pool thread blocks it, so nested calls run inline to avoid starving the pool.
+	if (p_rows < 2 || uint64_t(p_rows) * p_work_per_row < IMAGE_PARALLEL_MIN_WORK || !wtp || wtp->get_thread_count() < 2 || wtp->get_thread_index() != -1) {
+		p_func(0, p_rows);
+		return;
+	}
+
+	struct RowJob {
+		const F *func = nullptr;
+		uint32_t rows = 0;
+		uint32_t chunks = 0;
+
+		static void process(void *p_userdata, uint32_t p_index) {
+			const RowJob *job = static_cast<const RowJob *>(p_userdata);
+			uint32_t from = uint64_t(job->rows) * p_index / job->chunks;
+			uint32_t to = uint64_t(job->rows) * (p_index + 1) / job->chunks;
+			(*job->func)(from, to);
+		}
+	};
+
+	RowJob job;
+	job.func = &p_func;
+	job.rows = p_rows;
+	// A few chunks per thread keeps the load balanced when rows have uneven cost.
+	job.chunks = MIN(p_rows, uint32_t(wtp->get_thread_count()) * 4);
+
+	WorkerThreadPool::GroupID group_id = wtp->add_native_group_task(&RowJob::process, &job, job.chunks, -1, true, SNAME("ImageProcessRows"));
+	wtp->wait_for_group_task_completion(group_id);
+}
+
 // Using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers.
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
 	constexpr uint32_t max_bytes = MAX(read_bytes, write_bytes);
 
-	for (int y = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++) {
-			const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
-			uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+	_image_process_rows(p_height, p_width, [&](uint32_t p_from, uint32_t p_to) {
+		for (int y = p_from; y < (int)p_to; y++) {
+			for (int x = 0; x < p_width; x++) {
+				const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
+				uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
 
-			uint8_t rgba[4] = { 0, 0, 0, 255 };
+				uint8_t rgba[4] = { 0, 0, 0, 255 };
 
-			if constexpr (read_gray) {
-				rgba[0] = rofs[0];
-				rgba[1] = rofs[0];
-				rgba[2] = rofs[0];
-			} else {
-				for (uint32_t i = 0; i < max_bytes; i++) {
-					rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+				if constexpr (read_gray) {
+					rgba[0] = rofs[0];
+					rgba[1] = rofs[0];
+					rgba[2] = rofs[0];
+				} else {
+					for (uint32_t i = 0; i < max_bytes; i++) {
+						rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+					}
 				}
-			}
 
-			if constexpr (read_alpha || write_alpha) {
-				rgba[3] = read_alpha ? rofs[read_bytes] : 255;
-			}
+				if constexpr (read_alpha || write_alpha) {
+					rgba[3] = read_alpha ? rofs[read_bytes] : 255;
+				}
 
-			if constexpr (write_gray) {
-				// REC.709
-				const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
-				wofs[0] = luminance;
-			} else {
-				for (uint32_t i = 0; i < write_bytes; i++) {
-					wofs[i] = rgba[i];
+				if constexpr (write_gray) {
+					// REC.709
+					const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
+					wofs[0] = luminance;
+				} else {
+					for (uint32_t i = 0; i < write_bytes; i++) {
+						wofs[i] = rgba[i];
+					}
 				}
-			}
 
-			if constexpr (write_alpha) {
-				wofs[write_bytes] = rgba[3];
+				if constexpr (write_alpha) {
+					wofs[write_bytes] = rgba[3];
+				}
 			}
 		}
-	}
+	});
 }
 
 template <typename T, uint32_t read_channels, uint32_t write_channels, T def_zero, T def_one>
 static void _convert_fast(int p_width, int p_height, const T *p_src, T *p_dst) {
-	uint32_t dst_count = 0;
-	uint32_t src_count = 0;
+	_image_process_rows(p_height, p_width, [&](uint32_t p_from, uint32_t p_to) {
+		uint32_t dst_count = p_from * p_width * write_channels;
+		uint32_t src_count = p_from * p_width * read_channels;
 
-	const int resolution = p_width * p_height;
+		const uint32_t count = (p_to - p_from) * p_width;
 
-	for (int i = 0; i < resolution; i++) {
-		memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
+		for (uint32_t i = 0; i < count; i++) {
+			memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
 
-		if constexpr (write_channels > read_channels) {
-			const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
-			memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
-		}
+			if constexpr (write_channels > read_channels) {
+				const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
+				memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
+			}
 
-		dst_count += write_channels;
-		src_count += read_channels;
-	}
+			dst_count += write_channels;
+			src_count += read_channels;
+		}
+	});
 }
 
 static bool _are_formats_compatible(Image::Format p_format0, Image::Format p_format1) {
@@ -916,85 +958,86 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy;
-	int ox1, oy1, ox2, oy2;
-	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
-	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
-		// Y coordinates
-		oy = (double)(y + 0.5) * yfac - 0.5;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
+	_image_process_rows(p_dst_height, p_dst_width * CC * 16, [&](uint32_t p_from, uint32_t p_to) {
+		// coordinates of source points and coefficients
+		double ox, oy, dx, dy;
+		int ox1, oy1, ox2, oy2;
 
-		for (uint32_t x = 0; x < p_dst_width; x++) {
-			// X coordinates
-			ox = (double)(x + 0.5) * xfac - 0.5;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
+		for (uint32_t y = p_from; y < p_to; y++) {
+			// Y coordinates
+			oy = (double)(y + 0.5) * yfac - 0.5;
+			oy1 = (int)oy;
+			dy = oy - (double)oy1;
 
-			// initial pixel value
+			for (uint32_t x = 0; x < p_dst_width; x++) {
+				// X coordinates
+				ox = (double)(x + 0.5) * xfac - 0.5;
+				ox1 = (int)ox;
+				dx = ox - (double)ox1;
 
-			T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
+				// initial pixel value
 
-			double color[CC] = {};
+				T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
 
-			for (int n = -1; n < 3; n++) {
-				// get Y coefficient
-				[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
+				double color[CC] = {};
 
-				oy2 = oy1 + n;
-				if (oy2 < 0) {
-					oy2 = 0;
-				}
-				if (oy2 > ymax) {
-					oy2 = ymax;
-				}
+				for (int n = -1; n < 3; n++) {
+					// get Y coefficient
+					[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
 
-				for (int m = -1; m < 3; m++) {
-					// get X coefficient
-					[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
-
-					ox2 = ox1 + m;
-					if (ox2 < 0) {
-						ox2 = 0;
+					oy2 = oy1 + n;
+					if (oy2 < 0) {
+						oy2 = 0;
 					}
-					if (ox2 > xmax) {
-						ox2 = xmax;
+					if (oy2 > ymax) {
+						oy2 = ymax;
 					}
 
-					// get pixel of original image
-					const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+					for (int m = -1; m < 3; m++) {
+						// get X coefficient
+						[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					for (int i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
-							color[i] = Math::half_to_float(p[i]);
-						} else {
-							color[i] += p[i] * k2;
+						ox2 = ox1 + m;
+						if (ox2 < 0) {
+							ox2 = 0;
+						}
+						if (ox2 > xmax) {
+							ox2 = xmax;
+						}
+
+						// get pixel of original image
+						const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+
+						for (int i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
+								color[i] = Math::half_to_float(p[i]);
+							} else {
+								color[i] += p[i] * k2;
+							}
 						}
 					}
 				}
-			}
 
-			for (int i = 0; i < CC; i++) {
-				if constexpr (sizeof(T) == 1) { //byte
-					dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
-				} else if constexpr (sizeof(T) == 2) {
-					if constexpr (TYPE == IMAGE_SCALING_FLOAT) {
-						dst[i] = Math::make_half_float(color[i]); //half float
+				for (int i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 1) { //byte
+						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
+					} else if constexpr (sizeof(T) == 2) {
+						if constexpr (TYPE == IMAGE_SCALING_FLOAT) {
+							dst[i] = Math::make_half_float(color[i]); //half float
+						} else {
+							dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 65535); // uint16
+						}
 					} else {
-						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 65535); // uint16
+						dst[i] = color[i];
 					}
-				} else {
-					dst[i] = color[i];
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T, ImageScaleType TYPE>
@@ -1004,65 +1047,84 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		// Add 0.5 in order to interpolate based on pixel center
-		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
-		// Calculate nearest src pixel center above current, and truncate to get y index
-		uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
-		uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
-		if (src_yofs_down >= p_src_height) {
-			src_yofs_down = p_src_height - 1;
-		}
-		// Calculate distance to pixel center of src_yofs_up
-		uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
-		src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
-
-		uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
-		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
-
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
+	_image_process_rows(p_dst_height, p_dst_width * CC * 4, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			// Add 0.5 in order to interpolate based on pixel center
+			uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
+			// Calculate nearest src pixel center above current, and truncate to get y index
+			uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
+			uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
+			if (src_yofs_down >= p_src_height) {
+				src_yofs_down = p_src_height - 1;
 			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
-
-			for (uint32_t l = 0; l < CC; l++) {
-				if constexpr (sizeof(T) == 1) { //uint8
-					uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
-					uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
-
-					uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
-					interp >>= FRAC_BITS;
-					p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
-				} else if constexpr (sizeof(T) == 2) {
-					if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
-						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-						const T *src = ((const T *)p_src);
-						T *dst = ((T *)p_dst);
+			// Calculate distance to pixel center of src_yofs_up
+			uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
+			src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+
+			uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
+			uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+				uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+				uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+				if (src_xofs_right >= p_src_width) {
+					src_xofs_right = p_src_width - 1;
+				}
+				uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+				src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+				src_xofs_left *= CC;
+				src_xofs_right *= CC;
+
+				for (uint32_t l = 0; l < CC; l++) {
+					if constexpr (sizeof(T) == 1) { //uint8
+						uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
+						uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
+
+						uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
+						interp >>= FRAC_BITS;
+						p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
+					} else if constexpr (sizeof(T) == 2) {
+						if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
+							float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+							float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+							const T *src = ((const T *)p_src);
+							T *dst = ((T *)p_dst);
 
-						float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
-						float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
-						float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
-						float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
+							float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
+							float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
+							float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
+							float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
 
-						float interp_up = p00 + (p10 - p00) * xofs_frac;
-						float interp_down = p01 + (p11 - p01) * xofs_frac;
-						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+							float interp_up = p00 + (p10 - p00) * xofs_frac;
+							float interp_down = p01 + (p11 - p01) * xofs_frac;
+							float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+
+							dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
+						} else { //uint16
+							float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+							float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+							const T *src = ((const T *)p_src);
+							T *dst = ((T *)p_dst);
+
+							float p00 = src[y_ofs_up + src_xofs_left + l];
+							float p10 = src[y_ofs_up + src_xofs_right + l];
+							float p01 = src[y_ofs_down + src_xofs_left + l];
+							float p11 = src[y_ofs_down + src_xofs_right + l];
+
+							float interp_up = p00 + (p10 - p00) * xofs_frac;
+							float interp_down = p01 + (p11 - p01) * xofs_frac;
+							float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+
+							dst[i * p_dst_width * CC + j * CC + l] = uint16_t(interp);
+						}
+					} else if constexpr (sizeof(T) == 4) { //float
 
-						dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
-					} else { //uint16
 						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
 						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
 						const T *src = ((const T *)p_src);
@@ -1077,50 +1139,35 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 						float interp_down = p01 + (p11 - p01) * xofs_frac;
 						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-						dst[i * p_dst_width * CC + j * CC + l] = uint16_t(interp);
+						dst[i * p_dst_width * CC + j * CC + l] = interp;
 					}
-				} else if constexpr (sizeof(T) == 4) { //float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
-
-					float p00 = src[y_ofs_up + src_xofs_left + l];
-					float p10 = src[y_ofs_up + src_xofs_right + l];
-					float p01 = src[y_ofs_down + src_xofs_left + l];
-					float p11 = src[y_ofs_down + src_xofs_right + l];
-
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
-
-					dst[i * p_dst_width * CC + j * CC + l] = interp;
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
-		uint32_t y_ofs = src_yofs * p_src_width * CC;
+	_image_process_rows(p_dst_height, p_dst_width * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
+			uint32_t y_ofs = src_yofs * p_src_width * CC;
 
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs = (j + 0.5) * p_src_width / p_dst_width;
-			src_xofs *= CC;
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs = (j + 0.5) * p_src_width / p_dst_width;
+				src_xofs *= CC;
 
-			for (uint32_t l = 0; l < CC; l++) {
-				const T *src = ((const T *)p_src);
-				T *dst = ((T *)p_dst);
+				for (uint32_t l = 0; l < CC; l++) {
+					const T *src = ((const T *)p_src);
+					T *dst = ((T *)p_dst);
 
-				T p = src[y_ofs + src_xofs + l];
-				dst[i * p_dst_width * CC + j * CC + l] = p;
+					T p = src[y_ofs + src_xofs + l];
+					dst[i * p_dst_width * CC + j * CC + l] = p;
+				}
 			}
 		}
-	}
+	});
 }
 
 #define LANCZOS_TYPE 3
@@ -1146,47 +1193,50 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// Columns are independent, each range of them uses its own kernel scratch.
+		_image_process_rows(dst_width, src_height * half_kernel * 2 * CC, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			for (int32_t buffer_x = p_from; buffer_x < (int32_t)p_to; buffer_x++) {
+				// The corresponding point on the source image
+				float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+				int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+				int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
-			}
+				// Create the kernel used by all the pixels of the column
+				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+					kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+				}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2 && TYPE == IMAGE_SCALING_FLOAT) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -1196,54 +1246,56 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_image_process_rows(dst_height, dst_width * half_kernel * 2 * CC, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < (int32_t)p_to; dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) {
+							if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
+								dst_data[i] = Math::make_half_float(pixel[i]);
+							} else { //uint16
+								dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 65535);
+							}
 
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) {
-						if constexpr (TYPE == IMAGE_SCALING_FLOAT) { //half float
-							dst_data[i] = Math::make_half_float(pixel[i]);
-						} else { //uint16
-							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 65535);
+						} else { // float
+							dst_data[i] = pixel[i];
 						}
-
-					} else { // float
-						dst_data[i] = pixel[i];
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1993,27 +2045,29 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
+	_image_process_rows(dst_h, dst_w * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const Component *rup_ptr = &p_src[i * 2 * down_step];
+			const Component *rdown_ptr = rup_ptr + down_step;
+			Component *dst_ptr = &p_dst[i * dst_w * CC];
+			uint32_t count = dst_w;
+
+			while (count) {
+				count--;
+				for (int j = 0; j < CC; j++) {
+					average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				}
 
-		while (count) {
-			count--;
-			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
-			}
+				if constexpr (renormalize) {
+					renormalize_func(dst_ptr);
+				}
 
-			if constexpr (renormalize) {
-				renormalize_func(dst_ptr);
+				dst_ptr += CC;
+				rup_ptr += right_step * 2;
+				rdown_ptr += right_step * 2;
 			}
-
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
 		}
-	}
+	});
 }
 
 void Image::_generate_mipmap_from_format(Image::Format p_format, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, bool p_renormalize) {
@@ -4283,15 +4337,17 @@ void Image::premultiply_alpha() {
 
 	uint8_t *data_ptr = data.ptrw();
 
-	for (int i = 0; i < height; i++) {
-		for (int j = 0; j < width; j++) {
-			uint8_t *ptr = &data_ptr[(i * width + j) * 4];
+	_image_process_rows(height, width, [&](uint32_t p_from, uint32_t p_to) {
+		for (int i = p_from; i < (int)p_to; i++) {
+			for (int j = 0; j < width; j++) {
+				uint8_t *ptr = &data_ptr[(i * width + j) * 4];
 
-			ptr[0] = (uint16_t(ptr[0]) * uint16_t(ptr[3]) + 255U) >> 8;
-			ptr[1] = (uint16_t(ptr[1]) * uint16_t(ptr[3]) + 255U) >> 8;
-			ptr[2] = (uint16_t(ptr[2]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[0] = (uint16_t(ptr[0]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[1] = (uint16_t(ptr[1]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[2] = (uint16_t(ptr[2]) * uint16_t(ptr[3]) + 255U) >> 8;
+			}
 		}
-	}
+	});
 }
 
 void Image::fix_alpha_edges() {
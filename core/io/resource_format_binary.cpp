@@ -495,7 +495,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<uint8_t> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			uint8_t *w = array.ptrw();
 			f->get_buffer(w, len);
 			_advance_padding(len);
@@ -507,7 +507,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<int32_t> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			int32_t *w = array.ptrw();
 			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
 
@@ -517,7 +517,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<int64_t> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			int64_t *w = array.ptrw();
 			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
 
@@ -527,7 +527,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<float> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			float *w = array.ptrw();
 			f->get_buffer((uint8_t *)w, len * sizeof(float));
 
@@ -537,7 +537,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<double> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			double *w = array.ptrw();
 			f->get_buffer((uint8_t *)w, len * sizeof(double));
 
@@ -559,7 +559,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector2> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			Vector2 *w = array.ptrw();
 			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 2);
@@ -572,7 +572,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector3> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			Vector3 *w = array.ptrw();
 			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 3);
@@ -585,7 +585,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Color> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
@@ -597,7 +597,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			uint32_t len = f->get_32();
 
 			Vector<Vector4> array;
-			array.resize(len);
+			array.resize_uninitialized(len);
 			Vector4 *w = array.ptrw();
 			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
 			const Error err = read_reals(reinterpret_cast<real_t *>(w), f, len * 4);
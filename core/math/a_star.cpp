@@ -62,6 +62,7 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->closed_pass = 0;
 		pt->enabled = true;
 		points.insert_new(p_id, pt);
+		adjacency_dirty = true;
 	} else {
 		Point *found_pt = *point_entry;
 		found_pt->pos = p_pos;
@@ -122,6 +123,7 @@ void AStar3D::remove_point(int64_t p_id) {
 	memdelete(p);
 	points.erase(p_id);
 	last_free_id = p_id;
+	adjacency_dirty = true;
 }
 
 void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool p_bidirectional) {
@@ -160,6 +162,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool p_bidirection
 	}
 
 	segments.insert(s);
+	adjacency_dirty = true;
 }
 
 void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool p_bidirectional) {
@@ -199,6 +202,7 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool p_bidirect
 		if (s.direction != Segment::NONE) {
 			segments.insert(s);
 		}
+		adjacency_dirty = true;
 	}
 }
 
@@ -244,6 +248,8 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	adjacency.clear();
+	adjacency_dirty = true;
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -307,6 +313,31 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
+void AStar3D::_update_adjacency() {
+	if (!adjacency_dirty) {
+		return;
+	}
+
+	uint32_t adjacency_size = 0;
+	for (const KeyValue<int64_t, Point *> &kv : points) {
+		adjacency_size += kv.value->neighbors.size();
+	}
+
+	adjacency.resize(adjacency_size);
+
+	uint32_t adjacency_offset = 0;
+	for (const KeyValue<int64_t, Point *> &kv : points) {
+		Point *p = kv.value;
+		p->adjacency_offset = adjacency_offset;
+		p->adjacency_count = p->neighbors.size();
+		for (const KeyValue<int64_t, Point *> &neighbor_kv : p->neighbors) {
+			adjacency[adjacency_offset++] = neighbor_kv.value;
+		}
+	}
+
+	adjacency_dirty = false;
+}
+
 bool AStar3D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
 	last_closest_point = nullptr;
 	pass++;
@@ -321,19 +352,20 @@ bool AStar3D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_part
 		return false;
 	}
 
+	_update_adjacency();
+
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	open_list.clear();
 
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
 	p_begin_point->abs_g_score = 0;
 	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	open_list.push_back(p_begin_point);
+	open_list.push(p_begin_point);
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		Point *p = open_list.top(); // The currently processed point.
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
 		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
@@ -345,12 +377,12 @@ bool AStar3D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_part
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
+		open_list.pop(); // Remove the current point from the open list.
 		p->closed_pass = pass; // Mark the point as closed.
 
-		for (const KeyValue<int64_t, Point *> &kv : p->neighbors) {
-			Point *e = kv.value; // The neighbor point.
+		Point *const *neighbors = adjacency.ptr() + p->adjacency_offset;
+		for (uint32_t i = 0; i < p->adjacency_count; i++) {
+			Point *e = neighbors[i]; // The neighbor point.
 
 			if (!e->enabled || e->closed_pass == pass) {
 				continue;
@@ -369,7 +401,6 @@ bool AStar3D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_part
 
 			if (e->open_pass != pass) { // The point wasn't inside the open list.
 				e->open_pass = pass;
-				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
@@ -381,10 +412,10 @@ bool AStar3D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_part
 			e->abs_g_score = tentative_g_score;
 			e->abs_f_score = e->f_score - e->g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			if (new_point) {
+				open_list.push(e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+				open_list.update(e);
 			}
 		}
 	}
@@ -830,19 +861,21 @@ bool AStar2D::_solve(AStar3D::Point *p_begin_point, AStar3D::Point *p_end_point,
 		return false;
 	}
 
+	astar._update_adjacency();
+
 	bool found_route = false;
 
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
+	AStarOpenList<AStar3D::Point, AStar3D::SortPoints> &open_list = astar.open_list;
+	open_list.clear();
 
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
 	p_begin_point->abs_g_score = 0;
 	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	open_list.push_back(p_begin_point);
+	open_list.push(p_begin_point);
 
 	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
+		AStar3D::Point *p = open_list.top(); // The currently processed point.
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
 		if (astar.last_closest_point == nullptr || astar.last_closest_point->abs_f_score > p->abs_f_score || (astar.last_closest_point->abs_f_score >= p->abs_f_score && astar.last_closest_point->abs_g_score > p->abs_g_score)) {
@@ -854,12 +887,12 @@ bool AStar2D::_solve(AStar3D::Point *p_begin_point, AStar3D::Point *p_end_point,
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
+		open_list.pop(); // Remove the current point from the open list.
 		p->closed_pass = astar.pass; // Mark the point as closed.
 
-		for (KeyValue<int64_t, AStar3D::Point *> &kv : p->neighbors) {
-			AStar3D::Point *e = kv.value; // The neighbor point.
+		AStar3D::Point *const *neighbors = astar.adjacency.ptr() + p->adjacency_offset;
+		for (uint32_t i = 0; i < p->adjacency_count; i++) {
+			AStar3D::Point *e = neighbors[i]; // The neighbor point.
 
 			if (!e->enabled || e->closed_pass == astar.pass) {
 				continue;
@@ -878,7 +911,6 @@ bool AStar2D::_solve(AStar3D::Point *p_begin_point, AStar3D::Point *p_end_point,
 
 			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
 				e->open_pass = astar.pass;
-				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
@@ -890,10 +922,10 @@ bool AStar2D::_solve(AStar3D::Point *p_begin_point, AStar3D::Point *p_end_point,
 			e->abs_g_score = tentative_g_score;
 			e->abs_f_score = e->f_score - e->g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			if (new_point) {
+				open_list.push(e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+				open_list.update(e);
 			}
 		}
 	}
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/a_star_open_list.h"
 #include "core/object/gdvirtual.gen.h"
 #include "core/object/ref_counted.h"
 #include "core/templates/a_hash_map.h"
@@ -51,12 +52,17 @@ class AStar3D : public RefCounted {
 		AHashMap<int64_t, Point *> neighbors = 4u;
 		AHashMap<int64_t, Point *> unlinked_neighbours = 4u;
 
+		// Range of the neighbors in the compact adjacency list.
+		uint32_t adjacency_offset = 0;
+		uint32_t adjacency_count = 0;
+
 		// Used for pathfinding.
 		Point *prev_point = nullptr;
 		real_t g_score = 0;
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
+		uint32_t open_list_index = 0;
 
 		// Used for getting closest_point_of_last_pathing_call.
 		real_t abs_g_score = 0;
@@ -113,6 +119,13 @@ class AStar3D : public RefCounted {
 	Point *last_closest_point = nullptr;
 	bool neighbor_filter_enabled = false;
 
+	// The neighbors of all points in one array, rebuilt before a search when the connections changed.
+	LocalVector<Point *> adjacency;
+	bool adjacency_dirty = true;
+
+	AStarOpenList<Point, SortPoints> open_list;
+
+	void _update_adjacency();
 	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
 
 protected:
@@ -130,6 +130,8 @@ void AStarGrid2D::update() {
 	points.clear();
 	solid_mask.clear();
 
+	points.reserve(region.size.x * region.size.y);
+
 	const int32_t end_x = region.get_end().x;
 	const int32_t end_y = region.get_end().y;
 	const Vector2 half_cell_size = cell_size / 2;
@@ -138,7 +140,6 @@ void AStarGrid2D::update() {
 	}
 
 	for (int32_t y = region.position.y; y < end_y; y++) {
-		LocalVector<Point> line;
 		solid_mask.push_back(true);
 		for (int32_t x = region.position.x; x < end_x; x++) {
 			Vector2 v = offset;
@@ -155,11 +156,10 @@ void AStarGrid2D::update() {
 				default:
 					break;
 			}
-			line.push_back(Point(Vector2i(x, y), v));
+			points.push_back(Point(Vector2i(x, y), v));
 			solid_mask.push_back(false);
 		}
 		solid_mask.push_back(true);
-		points.push_back(std::move(line));
 	}
 
 	for (int32_t x = region.position.x; x < end_x + 2; x++) {
@@ -508,19 +508,17 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
-	LocalVector<Point *> nbors;
+	open_list.clear();
 
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
 	p_begin_point->abs_g_score = 0;
 	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	open_list.push_back(p_begin_point);
+	open_list.push(p_begin_point);
 	end = p_end_point;
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		Point *p = open_list.top(); // The currently processed point.
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
 		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
@@ -532,8 +530,7 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
+		open_list.pop(); // Remove the current point from the open list.
 		p->closed_pass = pass; // Mark the point as closed.
 
 		nbors.clear();
@@ -560,7 +557,6 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 
 			if (e->open_pass != pass) { // The point wasn't inside the open list.
 				e->open_pass = pass;
-				open_list.push_back(e);
 				new_point = true;
 			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
 				continue;
@@ -573,10 +569,10 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 			e->abs_g_score = tentative_g_score;
 			e->abs_f_score = e->f_score - e->g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+			if (new_point) {
+				open_list.push(e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+				open_list.update(e);
 			}
 		}
 	}
@@ -624,7 +620,7 @@ TypedArray<Dictionary> AStarGrid2D::get_point_data_in_region(const Rect2i &p_reg
 
 	for (int32_t y = start_y; y < end_y; y++) {
 		for (int32_t x = start_x; x < end_x; x++) {
-			const Point &p = points[y][x];
+			const Point &p = points[y * region.size.x + x];
 
 			Dictionary dict;
 			dict["id"] = p.id;
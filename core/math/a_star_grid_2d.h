@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/a_star_open_list.h"
 #include "core/object/gdvirtual.gen.h"
 #include "core/object/ref_counted.h"
 #include "core/templates/local_vector.h"
@@ -85,6 +86,7 @@ private:
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
+		uint32_t open_list_index = 0;
 
 		// Used for getting last_closest_point.
 		real_t abs_g_score = 0;
@@ -109,10 +111,13 @@ private:
 	};
 
 	LocalVector<bool> solid_mask;
-	LocalVector<LocalVector<Point>> points;
+	LocalVector<Point> points; // Row-major, one row per region line.
 	Point *end = nullptr;
 	Point *last_closest_point = nullptr;
 
+	AStarOpenList<Point, SortPoints> open_list;
+	LocalVector<Point *> nbors;
+
 	uint64_t pass = 1;
 
 private: // Internal routines.
@@ -120,13 +125,17 @@ private: // Internal routines.
 		return ((p_y - region.position.y + 1) * (region.size.x + 2)) + p_x - region.position.x + 1;
 	}
 
+	_FORCE_INLINE_ uint32_t _to_point_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + p_x - region.position.x;
+	}
+
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
 		return !solid_mask[_to_mask_index(p_x, p_y)];
 	}
 
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return &points[p_y - region.position.y][p_x - region.position.x];
+			return &points[_to_point_index(p_x, p_y)];
 		}
 		return nullptr;
 	}
@@ -144,15 +153,15 @@ private: // Internal routines.
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
-		return &points[p_y - region.position.y][p_x - region.position.x];
+		return &points[_to_point_index(p_x, p_y)];
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(const Vector2i &p_id) {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_to_point_index(p_id.x, p_id.y)];
 	}
 
 	_FORCE_INLINE_ const Point *_get_point_unchecked(const Vector2i &p_id) const {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_to_point_index(p_id.x, p_id.y)];
 	}
 
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  a_star_open_list.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+
+/**
+	Open list for the A* searches.
+
+	A binary heap with the same ordering as the SortArray heap functions. Every point
+	stores its heap index, so a point whose score improved is moved up in place instead
+	of being searched for in the list first. The buffer is reused between searches.
+*/
+
+template <typename T, typename Comparator>
+class AStarOpenList {
+	LocalVector<T *> heap;
+	Comparator compare;
+
+	_FORCE_INLINE_ void _place(uint32_t p_index, T *p_point) {
+		heap[p_index] = p_point;
+		p_point->open_list_index = p_index;
+	}
+
+	void _push_heap(uint32_t p_hole_index, T *p_point) {
+		uint32_t parent = (p_hole_index - 1) / 2;
+		while (p_hole_index > 0 && compare(heap[parent], p_point)) {
+			_place(p_hole_index, heap[parent]);
+			p_hole_index = parent;
+			parent = (p_hole_index - 1) / 2;
+		}
+		_place(p_hole_index, p_point);
+	}
+
+public:
+	_FORCE_INLINE_ bool is_empty() const { return heap.is_empty(); }
+	_FORCE_INLINE_ T *top() const { return heap[0]; }
+
+	void clear() { heap.clear(); }
+
+	void push(T *p_point) {
+		heap.push_back(p_point);
+		_push_heap(heap.size() - 1, p_point);
+	}
+
+	// Restores the heap order after the score of a point in the list decreased.
+	void update(T *p_point) {
+		_push_heap(p_point->open_list_index, p_point);
+	}
+
+	// Same as SortArray::pop_heap() over the whole list followed by removing the last element.
+	void pop() {
+		const uint32_t len = heap.size() - 1;
+		T *last = heap[len];
+
+		uint32_t hole_index = 0;
+		uint32_t second_child = 2;
+		while (second_child < len) {
+			if (compare(heap[second_child], heap[second_child - 1])) {
+				second_child--;
+			}
+			_place(hole_index, heap[second_child]);
+			hole_index = second_child;
+			second_child = 2 * (second_child + 1);
+		}
+		if (second_child == len) {
+			_place(hole_index, heap[second_child - 1]);
+			hole_index = second_child - 1;
+		}
+
+		heap.resize(len);
+		if (len > 0) {
+			_push_heap(hole_index, last);
+		}
+	}
+};
@@ -359,6 +359,7 @@ private:
 			// we defer the refit updates until the update function is called once per frame
 			if (refit) {
 				leaf.set_dirty(true);
+				_tree_set_dirty(p_tree_id);
 			}
 		} else {
 			// remove node if empty
@@ -2327,13 +2327,27 @@ void postinitialize_handler(Object *p_object) {
 
 void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
 	spin_lock.lock();
-
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
-			count--;
+	// Announce the walk before reading any slot, so a removal that misses it
+	// is guaranteed to have cleared its validator first (and gets skipped below).
+	debug_walk_count.fetch_add(1, std::memory_order_seq_cst);
+
+	for (uint32_t i = 0, count = object_count.get(), max = slot_max.get(); i < max && count != 0; i++) {
+		const ObjectSlot &slot = _get_slot(i);
+		const uint64_t validator = slot.validator.load(std::memory_order_seq_cst);
+		if (validator == 0) {
+			continue;
+		}
+		// Slots are added without the lock, so make sure the slot was not reused while it was being read.
+		Object *obj = slot.object.load(std::memory_order_acquire);
+		if (obj == nullptr || slot.validator.load(std::memory_order_acquire) != validator) {
+			continue;
 		}
+		// Removals of objects still valid here wait in `remove_instance` until the walk ends.
+		p_func(obj, p_user_data);
+		count--;
 	}
+
+	debug_walk_count.fetch_sub(1, std::memory_order_release);
 	spin_lock.unlock();
 }
 
@@ -2385,44 +2399,87 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+SafeNumeric<uint32_t> ObjectDB::slot_max;
+SafeNumeric<uint32_t> ObjectDB::object_count;
+ObjectDB::ObjectSlot *ObjectDB::slot_pages[OBJECTDB_SLOT_PAGE_COUNT] = {};
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+std::atomic<uint32_t> ObjectDB::debug_walk_count = 0;
+thread_local ObjectDB::ThreadCache ObjectDB::thread_cache;
+
+ObjectDB::ThreadCache::~ThreadCache() {
+	// Give the slots back when the thread exits, unless the ObjectDB is already gone.
+	if (count > 0 && slot_max.get() > 0) {
+		_flush_thread_cache(*this, 0);
+	}
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return object_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
+void ObjectDB::_refill_thread_cache(ThreadCache &r_cache) {
+	const uint32_t refill = ThreadCache::SIZE / 2;
+
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	uint32_t max = slot_max.get();
+	while (max - slot_count < refill) {
+		CRASH_COND_MSG(max == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS), "Too many object instances.");
+
+		ObjectSlot *page = memnew_arr(ObjectSlot, OBJECTDB_SLOT_PAGE_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_SIZE; i++) {
+			page[i].next_free = max + i;
 		}
-		slot_max = new_slot_max;
+		slot_pages[max >> OBJECTDB_SLOT_PAGE_BITS] = page;
+		max += OBJECTDB_SLOT_PAGE_SIZE;
+
+		// Publish only after the page is set up, readers check against it.
+		slot_max.set(max);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	for (uint32_t i = 0; i < refill; i++) {
+		r_cache.slots[r_cache.count++] = _get_slot(slot_count++).next_free;
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+
+	spin_lock.unlock();
+}
+
+void ObjectDB::_flush_thread_cache(ThreadCache &r_cache, uint32_t p_keep) {
+	spin_lock.lock();
+
+	while (r_cache.count > p_keep) {
+		// Push back into the shared free list.
+		slot_count--;
+		_get_slot(slot_count).next_free = r_cache.slots[--r_cache.count];
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	spin_lock.unlock();
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	ThreadCache &cache = thread_cache;
+	if (unlikely(cache.count == 0)) {
+		_refill_thread_cache(cache);
+	}
+
+	uint32_t slot = cache.slots[--cache.count];
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (unlikely(object_slot.object.load(std::memory_order_relaxed) != nullptr)) {
+		// Give the slot back so it is not lost.
+		cache.slots[cache.count++] = slot;
+		ERR_FAIL_V(ObjectID());
+	}
+
+	uint64_t validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	}
+
+	object_slot.is_ref_counted = p_object->is_ref_counted();
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator, std::memory_order_release);
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2430,9 +2487,7 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
+	object_count.increment();
 
 	return ObjectID(id);
 }
@@ -2441,33 +2496,36 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+		ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != validator);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_seq_cst);
+	if (unlikely(debug_walk_count.load(std::memory_order_seq_cst) != 0)) {
+		// A debug walk may have read the object before it was invalidated,
+		// wait for it to end so the object is not freed under its callback.
+		spin_lock.lock();
+		spin_lock.unlock();
+	}
+	object_slot.is_ref_counted = false;
+	object_slot.object.store(nullptr, std::memory_order_release);
 
-	spin_lock.unlock();
+	object_count.decrement();
+
+	//set the free slot properly
+	ThreadCache &cache = thread_cache;
+	if (unlikely(cache.count == ThreadCache::SIZE)) {
+		_flush_thread_cache(cache, ThreadCache::SIZE / 2);
+	}
+	cache.slots[cache.count++] = slot;
 }
 
 void ObjectDB::setup() {
@@ -2477,8 +2535,9 @@ void ObjectDB::setup() {
 void ObjectDB::cleanup() {
 	spin_lock.lock();
 
-	if (slot_count > 0) {
-		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", slot_count, slot_count == 1 ? "instance was" : "instances were"));
+	const uint32_t leaked_count = object_count.get();
+	if (leaked_count > 0) {
+		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", leaked_count, leaked_count == 1 ? "instance was" : "instances were"));
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
 			// that overrides any of those methods, it'd not be OK to call them at this point,
@@ -2487,9 +2546,14 @@ void ObjectDB::cleanup() {
 			const MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = leaked_count; i < slot_max.get() && count != 0; i++) {
+				const ObjectSlot &slot = _get_slot(i);
+				const uint64_t validator = slot.validator.load(std::memory_order_acquire);
+				if (validator) {
+					Object *obj = slot.object.load(std::memory_order_acquire);
+					if (obj == nullptr || slot.validator.load(std::memory_order_acquire) != validator) {
+						continue;
+					}
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2502,7 +2566,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS) | (slot.is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2513,9 +2577,14 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max.get(); i += OBJECTDB_SLOT_PAGE_SIZE) {
+		memdelete_arr(slot_pages[i >> OBJECTDB_SLOT_PAGE_BITS]);
+		slot_pages[i >> OBJECTDB_SLOT_PAGE_BITS] = nullptr;
 	}
+	slot_max.set(0);
+	slot_count = 0;
+	// Other threads are expected to be gone by now, but this one may outlive the ObjectDB.
+	thread_cache.count = 0;
 
 	spin_lock.unlock();
 }
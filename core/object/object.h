@@ -880,19 +880,44 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+// Slots are allocated in pages that never move, so they can be read without locking.
+#define OBJECTDB_SLOT_PAGE_BITS 12
+#define OBJECTDB_SLOT_PAGE_SIZE (1 << OBJECTDB_SLOT_PAGE_BITS)
+#define OBJECTDB_SLOT_PAGE_MASK (OBJECTDB_SLOT_PAGE_SIZE - 1)
+#define OBJECTDB_SLOT_PAGE_COUNT (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_PAGE_BITS))
+
+	struct ObjectSlot { // 192 bits per slot.
+		// The validator is set after the object when adding, and cleared before it when removing.
+		std::atomic<uint64_t> validator = 0;
+		std::atomic<Object *> object = nullptr;
+		uint32_t next_free = 0; // Protected by `spin_lock`.
+		bool is_ref_counted = false;
+	};
+
+	// Free slots kept by each thread, so most additions and removals don't need `spin_lock`.
+	struct ThreadCache {
+		static constexpr uint32_t SIZE = 64;
+		uint32_t slots[SIZE];
+		uint32_t count = 0;
 
-	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		~ThreadCache();
 	};
 
 	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static uint32_t slot_count; // Slots taken from the shared free list.
+	static SafeNumeric<uint32_t> slot_max;
+	static SafeNumeric<uint32_t> object_count;
+	static ObjectSlot *slot_pages[OBJECTDB_SLOT_PAGE_COUNT];
+	static SafeNumeric<uint64_t> validator_counter;
+	static std::atomic<uint32_t> debug_walk_count; // Walks in `debug_objects`, removals wait for them to end.
+	static thread_local ThreadCache thread_cache;
+
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_SLOT_PAGE_BITS][p_slot & OBJECTDB_SLOT_PAGE_MASK];
+	}
+
+	static void _refill_thread_cache(ThreadCache &r_cache);
+	static void _flush_thread_cache(ThreadCache &r_cache, uint32_t p_keep);
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -911,20 +936,21 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.get(), nullptr); // This should never happen unless RID is corrupted.
 
+		const ObjectSlot &object_slot = _get_slot(slot);
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// Validators are never reused, so if it still matches, the object was not replaced in between.
+		if (unlikely(object_slot.validator.load(std::memory_order_relaxed) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -135,6 +135,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(PHYSICS_3D_BROADPHASE_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_MAP_BUILD_TIME);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_PATH_CORRIDOR_CACHE_HITS);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_PATH_CORRIDOR_CACHE_MISSES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -230,6 +234,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("physics_3d/broadphase_time"),
+		PNAME("navigation_3d/map_build_time"),
+		PNAME("navigation_3d/path_corridor_cache_hits"),
+		PNAME("navigation_3d/path_corridor_cache_misses"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -306,6 +314,8 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PS3DE::INFO_COLLISION_PAIRS);
 		case PHYSICS_3D_ISLAND_COUNT:
 			return PhysicsServer3D::get_singleton()->get_process_info(PS3DE::INFO_ISLAND_COUNT);
+		case PHYSICS_3D_BROADPHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PS3DE::INFO_BROADPHASE_TIME));
 #else
 		case PHYSICS_3D_ACTIVE_OBJECTS:
 			return 0;
@@ -313,6 +323,8 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return 0;
 		case PHYSICS_3D_ISLAND_COUNT:
 			return 0;
+		case PHYSICS_3D_BROADPHASE_TIME:
+			return 0;
 #endif // PHYSICS_3D_DISABLED
 
 		case AUDIO_OUTPUT_LATENCY:
@@ -453,6 +465,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_3D_MAP_BUILD_TIME:
+			return USEC_TO_SEC(NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_MAP_BUILD_TIME));
+		case NAVIGATION_3D_PATH_CORRIDOR_CACHE_HITS:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_HIT_COUNT);
+		case NAVIGATION_3D_PATH_CORRIDOR_CACHE_MISSES:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_MISS_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
 		default: {
@@ -527,7 +545,10 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
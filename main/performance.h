@@ -122,6 +122,10 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		PHYSICS_3D_BROADPHASE_TIME,
+		NAVIGATION_3D_MAP_BUILD_TIME,
+		NAVIGATION_3D_PATH_CORRIDOR_CACHE_HITS,
+		NAVIGATION_3D_PATH_CORRIDOR_CACHE_MISSES,
 		MONITOR_MAX
 	};
 
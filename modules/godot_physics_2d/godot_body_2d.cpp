@@ -149,6 +149,45 @@ void GodotBody2D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody2D::get_simulation_state(SimulationState &r_state) const {
+	r_state.transform = get_transform();
+	r_state.new_transform = new_transform;
+	r_state.linear_velocity = linear_velocity;
+	r_state.constant_linear_velocity = constant_linear_velocity;
+	r_state.applied_force = applied_force;
+	r_state.constant_force = constant_force;
+	r_state.angular_velocity = angular_velocity;
+	r_state.constant_angular_velocity = constant_angular_velocity;
+	r_state.applied_torque = applied_torque;
+	r_state.constant_torque = constant_torque;
+	r_state.still_time = still_time;
+	r_state.active = active;
+}
+
+void GodotBody2D::set_simulation_state(const SimulationState &p_state) {
+	_set_transform(p_state.transform);
+	_set_inv_transform(get_transform().affine_inverse());
+	new_transform = p_state.new_transform;
+	linear_velocity = p_state.linear_velocity;
+	constant_linear_velocity = p_state.constant_linear_velocity;
+	applied_force = p_state.applied_force;
+	constant_force = p_state.constant_force;
+	angular_velocity = p_state.angular_velocity;
+	constant_angular_velocity = p_state.constant_angular_velocity;
+	applied_torque = p_state.applied_torque;
+	constant_torque = p_state.constant_torque;
+	still_time = p_state.still_time;
+	biased_linear_velocity = Vector2();
+	biased_angular_velocity = 0.0;
+	_update_transform_dependent();
+	set_active(p_state.active);
+
+	// Sleeping bodies aren't integrated, so queue the state sync here for nodes to pick up the restored transform.
+	if (get_space() && (fi_callback_data || body_state_callback.is_valid())) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void GodotBody2D::set_param(PS2DE::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PS2DE::BODY_PARAM_BOUNCE: {
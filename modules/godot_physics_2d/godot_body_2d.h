@@ -158,6 +158,29 @@ class GodotBody2D : public GodotCollisionObject2D {
 	friend class GodotPhysicsDirectBodyState2D; // i give up, too many functions to expose
 
 public:
+	// Everything the solver carries from one step to the next, used to save and restore spaces.
+	struct SimulationState {
+		Transform2D transform;
+		Transform2D new_transform;
+		Vector2 linear_velocity;
+		Vector2 constant_linear_velocity;
+		Vector2 applied_force;
+		Vector2 constant_force;
+		real_t angular_velocity = 0.0;
+		real_t constant_angular_velocity = 0.0;
+		real_t applied_torque = 0.0;
+		real_t constant_torque = 0.0;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	struct StableOrder {
+		_FORCE_INLINE_ bool operator()(const GodotBody2D *p_a, const GodotBody2D *p_b) const { return p_a->get_self().get_id() < p_b->get_self().get_id(); }
+	};
+
+	void get_simulation_state(SimulationState &r_state) const;
+	void set_simulation_state(const SimulationState &p_state);
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
@@ -272,7 +272,12 @@ bool GodotBodyPair2D::setup(real_t p_step) {
 	//use local A coordinates to avoid numerical issues on collision detection
 	offset_B = B->get_transform().get_origin() - A->get_transform().get_origin();
 
-	_validate_contacts();
+	if (space->is_deterministic()) {
+		// Cached contacts and their accumulated impulses depend on the pair's history, which a space snapshot doesn't capture.
+		contact_count = 0;
+	} else {
+		_validate_contacts();
+	}
 
 	const Vector2 &offset_A = A->get_transform().get_origin();
 	Transform2D xform_Au = A->get_transform().untranslated();
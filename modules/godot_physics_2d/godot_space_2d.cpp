@@ -1090,7 +1090,10 @@ const HashSet<GodotCollisionObject2D *> &GodotSpace2D::get_objects() const {
 }
 
 void GodotSpace2D::body_add_to_state_query_list(SelfList<GodotBody2D> *p_body) {
-	state_query_list.add(p_body);
+	// Restoring a state may already have queued the body before it is stepped.
+	if (!p_body->in_list()) {
+		state_query_list.add(p_body);
+	}
 }
 
 void GodotSpace2D::body_remove_from_state_query_list(SelfList<GodotBody2D> *p_body) {
@@ -1212,6 +1215,127 @@ bool GodotSpace2D::is_locked() const {
 	return locked;
 }
 
+#define STATE_MAGIC 0x44325347 // "GS2D"
+#define STATE_VERSION 1
+#define STATE_HEADER_SIZE (4 * sizeof(uint32_t))
+#define STATE_BODY_REALS 25
+#define STATE_BODY_SIZE (sizeof(uint64_t) + STATE_BODY_REALS * sizeof(real_t) + 1)
+
+static _FORCE_INLINE_ void _state_write_reals(uint8_t *&w, std::initializer_list<real_t> p_values) {
+	for (real_t value : p_values) {
+		memcpy(w, &value, sizeof(real_t));
+		w += sizeof(real_t);
+	}
+}
+
+static _FORCE_INLINE_ real_t _state_read_real(const uint8_t *&r) {
+	real_t value;
+	memcpy(&value, r, sizeof(real_t));
+	r += sizeof(real_t);
+	return value;
+}
+
+static _FORCE_INLINE_ Vector2 _state_read_vector2(const uint8_t *&r) {
+	real_t x = _state_read_real(r);
+	real_t y = _state_read_real(r);
+	return Vector2(x, y);
+}
+
+static _FORCE_INLINE_ Transform2D _state_read_transform(const uint8_t *&r) {
+	Transform2D xform;
+	for (int i = 0; i < 3; i++) {
+		xform.columns[i] = _state_read_vector2(r);
+	}
+	return xform;
+}
+
+Vector<uint8_t> GodotSpace2D::save_state() const {
+	LocalVector<GodotBody2D *> bodies;
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies.push_back(static_cast<GodotBody2D *>(E));
+		}
+	}
+	bodies.sort_custom<GodotBody2D::StableOrder>();
+
+	Vector<uint8_t> state;
+	state.resize(STATE_HEADER_SIZE + bodies.size() * STATE_BODY_SIZE);
+	uint8_t *w = state.ptrw();
+
+	const uint32_t header[4] = { STATE_MAGIC, STATE_VERSION, (uint32_t)sizeof(real_t), bodies.size() };
+	memcpy(w, header, STATE_HEADER_SIZE);
+	w += STATE_HEADER_SIZE;
+
+	GodotBody2D::SimulationState body_state;
+	for (const GodotBody2D *body : bodies) {
+		body->get_simulation_state(body_state);
+
+		const uint64_t id = body->get_self().get_id();
+		memcpy(w, &id, sizeof(uint64_t));
+		w += sizeof(uint64_t);
+
+		const Transform2D &t = body_state.transform;
+		const Transform2D &nt = body_state.new_transform;
+		_state_write_reals(w, { t.columns[0].x, t.columns[0].y, t.columns[1].x, t.columns[1].y, t.columns[2].x, t.columns[2].y });
+		_state_write_reals(w, { nt.columns[0].x, nt.columns[0].y, nt.columns[1].x, nt.columns[1].y, nt.columns[2].x, nt.columns[2].y });
+		_state_write_reals(w, { body_state.linear_velocity.x, body_state.linear_velocity.y, body_state.constant_linear_velocity.x, body_state.constant_linear_velocity.y });
+		_state_write_reals(w, { body_state.applied_force.x, body_state.applied_force.y, body_state.constant_force.x, body_state.constant_force.y });
+		_state_write_reals(w, { body_state.angular_velocity, body_state.constant_angular_velocity, body_state.applied_torque, body_state.constant_torque, body_state.still_time });
+		*w++ = body_state.active ? 1 : 0;
+	}
+
+	return state;
+}
+
+bool GodotSpace2D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(locked, false, "Space state can't be restored while the space is being stepped.");
+	ERR_FAIL_COND_V_MSG(p_state.size() < (int64_t)STATE_HEADER_SIZE, false, "Invalid space state.");
+
+	const uint8_t *r = p_state.ptr();
+	uint32_t header[4];
+	memcpy(header, r, STATE_HEADER_SIZE);
+	r += STATE_HEADER_SIZE;
+
+	ERR_FAIL_COND_V_MSG(header[0] != STATE_MAGIC || header[1] != STATE_VERSION, false, "Invalid space state.");
+	ERR_FAIL_COND_V_MSG(header[2] != sizeof(real_t), false, "Space state was saved with a different floating-point precision.");
+	ERR_FAIL_COND_V_MSG(p_state.size() != (int64_t)(STATE_HEADER_SIZE + header[3] * STATE_BODY_SIZE), false, "Invalid space state.");
+
+	HashMap<uint64_t, GodotBody2D *> bodies;
+	for (GodotCollisionObject2D *E : objects) {
+		if (E->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody2D *>(E));
+		}
+	}
+
+	GodotBody2D::SimulationState body_state;
+	for (uint32_t i = 0; i < header[3]; i++) {
+		uint64_t id;
+		memcpy(&id, r, sizeof(uint64_t));
+		r += sizeof(uint64_t);
+
+		body_state.transform = _state_read_transform(r);
+		body_state.new_transform = _state_read_transform(r);
+		body_state.linear_velocity = _state_read_vector2(r);
+		body_state.constant_linear_velocity = _state_read_vector2(r);
+		body_state.applied_force = _state_read_vector2(r);
+		body_state.constant_force = _state_read_vector2(r);
+		body_state.angular_velocity = _state_read_real(r);
+		body_state.constant_angular_velocity = _state_read_real(r);
+		body_state.applied_torque = _state_read_real(r);
+		body_state.constant_torque = _state_read_real(r);
+		body_state.still_time = _state_read_real(r);
+		body_state.active = *r++ != 0;
+
+		// Bodies removed since the state was saved are skipped, bodies added since keep their current state.
+		GodotBody2D **body = bodies.getptr(id);
+		if (body) {
+			(*body)->set_simulation_state(body_state);
+		}
+	}
+
+	return true;
+}
+
 GodotPhysicsDirectSpaceState2D *GodotSpace2D::get_direct_state() {
 	return direct_access;
 }
@@ -1226,6 +1350,7 @@ GodotSpace2D::GodotSpace2D() {
 	contact_max_allowed_penetration = GLOBAL_GET("physics/2d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/2d/solver/default_contact_bias");
 	constraint_bias = GLOBAL_GET("physics/2d/solver/default_constraint_bias");
+	deterministic = GLOBAL_GET("physics/2d/solver/deterministic");
 
 	broadphase = GodotBroadPhase2D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
@@ -100,6 +100,8 @@ private:
 	real_t contact_bias = 0.0;
 	real_t constraint_bias = 0.0;
 
+	bool deterministic = false;
+
 	enum {
 		INTERSECTION_QUERY_MAX = 2048
 	};
@@ -163,6 +165,7 @@ public:
 	_FORCE_INLINE_ real_t get_body_linear_velocity_sleep_threshold() const { return body_linear_velocity_sleep_threshold; }
 	_FORCE_INLINE_ real_t get_body_angular_velocity_sleep_threshold() const { return body_angular_velocity_sleep_threshold; }
 	_FORCE_INLINE_ real_t get_body_time_to_sleep() const { return body_time_to_sleep; }
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
 
 	void update();
 	void setup();
@@ -186,6 +189,9 @@ public:
 
 	int get_collision_pairs() const { return collision_pairs; }
 
+	Vector<uint8_t> save_state() const;
+	bool restore_state(const Vector<uint8_t> &p_state);
+
 	bool test_body_motion(GodotBody2D *p_body, const PS2DT::MotionParameters &p_parameters, PS2DT::MotionResult *r_result);
 
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
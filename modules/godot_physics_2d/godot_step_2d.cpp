@@ -41,6 +41,72 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+// Orders constraints by the bodies they act on so islands are solved in the same order regardless of pair creation history.
+struct ConstraintStableOrder {
+	_FORCE_INLINE_ void _get_body_ids(const GodotConstraint2D *p_constraint, uint64_t &r_min, uint64_t &r_max) const {
+		r_min = UINT64_MAX;
+		r_max = 0;
+		for (int i = 0; i < p_constraint->get_body_count(); i++) {
+			uint64_t id = p_constraint->get_body_ptr()[i]->get_self().get_id();
+			r_min = MIN(r_min, id);
+			r_max = MAX(r_max, id);
+		}
+	}
+
+	_FORCE_INLINE_ bool operator()(const GodotConstraint2D *p_a, const GodotConstraint2D *p_b) const {
+		uint64_t min_a, max_a, min_b, max_b;
+		_get_body_ids(p_a, min_a, max_a);
+		_get_body_ids(p_b, min_b, max_b);
+		if (min_a != min_b) {
+			return min_a < min_b;
+		}
+		if (max_a != max_b) {
+			return max_a < max_b;
+		}
+		return p_a->get_order_key() < p_b->get_order_key();
+	}
+};
+
+void GodotStep2D::_sort_active_bodies(const SelfList<GodotBody2D>::List *p_body_list) {
+	sorted_bodies.clear();
+	for (const SelfList<GodotBody2D> *b = p_body_list->first(); b; b = b->next()) {
+		sorted_bodies.push_back(b->self());
+	}
+	sorted_bodies.sort_custom<GodotBody2D::StableOrder>();
+}
+
+void GodotStep2D::_generate_island(GodotBody2D *p_body, uint32_t &r_body_island_count, uint32_t &r_island_count) {
+	if (p_body->get_island_step() == _step) {
+		return;
+	}
+
+	++r_body_island_count;
+	if (body_islands.size() < r_body_island_count) {
+		body_islands.resize(r_body_island_count);
+	}
+	LocalVector<GodotBody2D *> &body_island = body_islands[r_body_island_count - 1];
+	body_island.clear();
+	body_island.reserve(BODY_ISLAND_SIZE_RESERVE);
+
+	++r_island_count;
+	if (constraint_islands.size() < r_island_count) {
+		constraint_islands.resize(r_island_count);
+	}
+	LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[r_island_count - 1];
+	constraint_island.clear();
+	constraint_island.reserve(ISLAND_SIZE_RESERVE);
+
+	_populate_island(p_body, body_island, constraint_island);
+
+	if (body_island.is_empty()) {
+		--r_body_island_count;
+	}
+
+	if (constraint_island.is_empty()) {
+		--r_island_count;
+	}
+}
+
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -144,13 +210,24 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
+	// In deterministic mode, bodies are processed by RID rather than by activation order, which isn't part of a space snapshot.
+	const bool deterministic = p_space->is_deterministic();
+
 	int active_count = 0;
 
 	const SelfList<GodotBody2D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	if (deterministic) {
+		_sort_active_bodies(body_list);
+		for (GodotBody2D *body : sorted_bodies) {
+			body->integrate_forces(p_delta);
+		}
+		active_count = sorted_bodies.size();
+	} else {
+		while (b) {
+			b->self()->integrate_forces(p_delta);
+			b = b->next();
+			active_count++;
+		}
 	}
 
 	p_space->set_active_objects(active_count);
@@ -194,41 +271,20 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
-
 	uint32_t body_island_count = 0;
 
-	while (b) {
-		GodotBody2D *body = b->self();
-
-		if (body->get_island_step() != _step) {
-			++body_island_count;
-			if (body_islands.size() < body_island_count) {
-				body_islands.resize(body_island_count);
-			}
-			LocalVector<GodotBody2D *> &body_island = body_islands[body_island_count - 1];
-			body_island.clear();
-			body_island.reserve(BODY_ISLAND_SIZE_RESERVE);
-
-			++island_count;
-			if (constraint_islands.size() < island_count) {
-				constraint_islands.resize(island_count);
-			}
-			LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_count - 1];
-			constraint_island.clear();
-			constraint_island.reserve(ISLAND_SIZE_RESERVE);
-
-			_populate_island(body, body_island, constraint_island);
-
-			if (body_island.is_empty()) {
-				--body_island_count;
-			}
-
-			if (constraint_island.is_empty()) {
-				--island_count;
-			}
+	if (deterministic) {
+		// Integrating forces can deactivate bodies, so sort again.
+		_sort_active_bodies(body_list);
+		for (GodotBody2D *body : sorted_bodies) {
+			_generate_island(body, body_island_count, island_count);
+		}
+	} else {
+		b = body_list->first();
+		while (b) {
+			_generate_island(b->self(), body_island_count, island_count);
+			b = b->next();
 		}
-		b = b->next();
 	}
 
 	p_space->set_island_count((int)island_count);
@@ -255,6 +311,9 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (deterministic) {
+			constraint_islands[island_index].sort_custom<ConstraintStableOrder>();
+		}
 		_pre_solve_island(constraint_islands[island_index]);
 	}
 
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  test_godot_physics_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "servers/physics_2d/physics_server_2d.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics2D {
+
+TEST_CASE("[SceneTree][GodotPhysics2D] Deterministic spaces should resimulate restored states identically") {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+	ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", true);
+	physics_server->set_active(true);
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID ground_shape = physics_server->rectangle_shape_create();
+	physics_server->shape_set_data(ground_shape, Vector2(200, 10));
+	RID ground = physics_server->body_create();
+	physics_server->body_set_mode(ground, PS2DE::BODY_MODE_STATIC);
+	physics_server->body_add_shape(ground, ground_shape);
+	physics_server->body_set_state(ground, PS2DE::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 100)));
+	physics_server->body_set_space(ground, space);
+
+	// A small stack plus a box thrown at it, so the steps after the snapshot have contacts to solve.
+	RID box_shape = physics_server->rectangle_shape_create();
+	physics_server->shape_set_data(box_shape, Vector2(10, 10));
+	LocalVector<RID> boxes;
+	for (int i = 0; i < 4; i++) {
+		RID box = physics_server->body_create();
+		physics_server->body_set_mode(box, PS2DE::BODY_MODE_RIGID);
+		physics_server->body_add_shape(box, box_shape);
+		physics_server->body_set_constant_force(box, Vector2(0, 980));
+		if (i < 3) {
+			physics_server->body_set_state(box, PS2DE::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(i * 2, 80 - i * 21)));
+		} else {
+			physics_server->body_set_state(box, PS2DE::BODY_STATE_TRANSFORM, Transform2D(0.3, Vector2(-60, 40)));
+			physics_server->body_set_state(box, PS2DE::BODY_STATE_LINEAR_VELOCITY, Vector2(300, 0));
+		}
+		physics_server->body_set_space(box, space);
+		boxes.push_back(box);
+	}
+
+	const real_t step = 1.0 / 60.0;
+	for (int i = 0; i < 10; i++) {
+		physics_server->step(step);
+	}
+
+	const Vector<uint8_t> saved_state = physics_server->space_save_state(space);
+	REQUIRE_FALSE(saved_state.is_empty());
+
+	physics_server->step(step);
+	physics_server->step(step);
+	const Vector<uint8_t> first_state = physics_server->space_save_state(space);
+	CHECK_MESSAGE(first_state != saved_state, "Stepping should change the state of the bodies.");
+
+	CHECK(physics_server->space_restore_state(space, saved_state));
+	CHECK_MESSAGE(physics_server->space_save_state(space) == saved_state, "Restoring should give back the saved state.");
+
+	physics_server->step(step);
+	physics_server->step(step);
+	const Vector<uint8_t> second_state = physics_server->space_save_state(space);
+	CHECK_MESSAGE(second_state == first_state, "Stepping from a restored state should give the same result.");
+
+	for (const RID &box : boxes) {
+		physics_server->free_rid(box);
+	}
+	physics_server->free_rid(box_shape);
+	physics_server->free_rid(ground);
+	physics_server->free_rid(ground_shape);
+	physics_server->free_rid(space);
+
+	physics_server->set_active(false);
+	ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", false);
+}
+
+} // namespace TestGodotPhysics2D
@@ -35,6 +35,8 @@
 #include "godot_constraint_3d.h"
 #include "godot_space_3d.h"
 
+#include "servers/rendering/rendering_server.h"
+
 void GodotBody3D::_mass_properties_changed() {
 	if (get_space() && !mass_properties_update_list.in_list()) {
 		get_space()->body_add_to_mass_properties_update_list(&mass_properties_update_list);
@@ -190,6 +192,60 @@ void GodotBody3D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody3D::get_simulation_state(SimulationState &r_state) const {
+	r_state.transform = get_transform();
+	r_state.new_transform = new_transform;
+	r_state.linear_velocity = linear_velocity;
+	r_state.constant_linear_velocity = constant_linear_velocity;
+	r_state.angular_velocity = angular_velocity;
+	r_state.constant_angular_velocity = constant_angular_velocity;
+	r_state.applied_force = applied_force;
+	r_state.constant_force = constant_force;
+	r_state.applied_torque = applied_torque;
+	r_state.constant_torque = constant_torque;
+	r_state.still_time = still_time;
+	r_state.active = active;
+}
+
+void GodotBody3D::set_simulation_state(const SimulationState &p_state) {
+	_set_transform(p_state.transform);
+	_set_inv_transform(get_transform().affine_inverse());
+	new_transform = p_state.new_transform;
+	linear_velocity = p_state.linear_velocity;
+	constant_linear_velocity = p_state.constant_linear_velocity;
+	angular_velocity = p_state.angular_velocity;
+	constant_angular_velocity = p_state.constant_angular_velocity;
+	applied_force = p_state.applied_force;
+	constant_force = p_state.constant_force;
+	applied_torque = p_state.applied_torque;
+	constant_torque = p_state.constant_torque;
+	still_time = p_state.still_time;
+	biased_linear_velocity = Vector3();
+	biased_angular_velocity = Vector3();
+	_update_transform_dependent();
+	set_active(p_state.active);
+	if (has_render_target()) {
+		_write_render_transform(true);
+	}
+
+	// Sleeping bodies aren't integrated, so queue the state sync here for nodes to pick up the restored transform.
+	if (get_space() && (fi_callback_data || body_state_callback.is_valid())) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
+void GodotBody3D::shift_origin(const Vector3 &p_offset) {
+	Transform3D shifted_transform = get_transform();
+	shifted_transform.origin -= p_offset;
+	new_transform.origin -= p_offset;
+	_set_transform(shifted_transform);
+	_set_inv_transform(shifted_transform.affine_inverse());
+	_update_transform_dependent();
+	if (has_render_target()) {
+		_write_render_transform(true);
+	}
+}
+
 void GodotBody3D::set_param(PS3DE::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PS3DE::BODY_PARAM_BOUNCE: {
@@ -377,6 +433,9 @@ void GodotBody3D::set_state(PS3DE::BodyState p_state, const Variant &p_variant)
 				_set_inv_transform(get_transform().inverse());
 				_update_transform_dependent();
 			}
+			if (mode != PS3DE::BODY_MODE_KINEMATIC && has_render_target()) {
+				_write_render_transform(true);
+			}
 			wakeup();
 
 		} break;
@@ -474,7 +533,7 @@ bool GodotBody3D::is_axis_locked(PS3DE::BodyAxis p_axis) const {
 	return locked_axis & p_axis;
 }
 
-void GodotBody3D::integrate_forces(real_t p_step) {
+void GodotBody3D::integrate_forces(real_t p_step, bool p_deferred) {
 	if (mode == PS3DE::BODY_MODE_STATIC) {
 		return;
 	}
@@ -665,21 +724,30 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		if (p_deferred) {
+			_compute_shapes_aabb_with_motion(motion);
+			deferred_broadphase_update = true;
+		} else {
+			_update_shapes_with_motion(motion);
+		}
 	}
 
 	contact_count = 0;
 }
 
-void GodotBody3D::integrate_velocities(real_t p_step) {
+void GodotBody3D::integrate_velocities(real_t p_step, bool p_deferred) {
 	if (mode == PS3DE::BODY_MODE_STATIC) {
 		return;
 	}
 
 	ERR_FAIL_NULL(get_space());
 
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	if (fi_callback_data || body_state_callback.is_valid() || has_render_target()) {
+		if (p_deferred) {
+			deferred_state_query = true;
+		} else {
+			get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		}
 	}
 
 	//apply axis lock linear
@@ -702,7 +770,11 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			if (p_deferred) {
+				deferred_deactivation = true;
+			} else {
+				set_active(false); //stopped moving, deactivate
+			}
 		}
 
 		return;
@@ -731,12 +803,33 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, !p_deferred);
+	if (p_deferred) {
+		_compute_shapes_aabb();
+		deferred_broadphase_update = true;
+	}
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::apply_deferred_integration() {
+	if (deferred_broadphase_update) {
+		deferred_broadphase_update = false;
+		_flush_shapes_to_broadphase();
+	}
+
+	if (deferred_state_query) {
+		deferred_state_query = false;
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (deferred_deactivation) {
+		deferred_deactivation = false;
+		set_active(false); //stopped moving, deactivate
+	}
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
@@ -760,6 +853,14 @@ void GodotBody3D::wakeup_neighbours() {
 }
 
 void GodotBody3D::call_queries() {
+	if (has_render_target()) {
+		_write_render_transform(false);
+	}
+
+	if (!fi_callback_data && !body_state_callback.is_valid()) {
+		return;
+	}
+
 	Variant direct_state_variant = get_direct_state();
 
 	if (fi_callback_data) {
@@ -816,6 +917,39 @@ void GodotBody3D::set_force_integration_callback(const Callable &p_callable, con
 	}
 }
 
+void GodotBody3D::_write_render_transform(bool p_teleport) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	if (render_instance.is_valid()) {
+		rs->instance_set_transform(render_instance, get_transform());
+		if (p_teleport) {
+			rs->instance_teleport(render_instance);
+		}
+	}
+
+	if (render_multimesh.is_valid()) {
+		rs->multimesh_instance_set_transform(render_multimesh, render_multimesh_index, get_transform());
+		if (p_teleport) {
+			rs->multimesh_instance_reset_physics_interpolation(render_multimesh, render_multimesh_index);
+		}
+	}
+}
+
+void GodotBody3D::set_render_instance(RID p_instance) {
+	render_instance = p_instance;
+	if (render_instance.is_valid()) {
+		_write_render_transform(true);
+	}
+}
+
+void GodotBody3D::set_render_multimesh(RID p_multimesh, int p_index) {
+	render_multimesh = p_multimesh;
+	render_multimesh_index = p_index;
+	if (render_multimesh.is_valid()) {
+		_write_render_transform(true);
+	}
+}
+
 GodotPhysicsDirectBodyState3D *GodotBody3D::get_direct_state() {
 	if (!direct_state) {
 		direct_state = memnew(GodotPhysicsDirectBodyState3D);
@@ -108,6 +108,11 @@ class GodotBody3D : public GodotCollisionObject3D {
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
 
+	// Space updates postponed by a deferred integration, see `apply_deferred_integration()`.
+	bool deferred_broadphase_update = false;
+	bool deferred_state_query = false;
+	bool deferred_deactivation = false;
+
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
@@ -135,6 +140,11 @@ class GodotBody3D : public GodotCollisionObject3D {
 
 	Callable body_state_callback;
 
+	// Written to directly whenever the body moves, so bodies without a node don't need a state sync callback.
+	RID render_instance;
+	RID render_multimesh;
+	int render_multimesh_index = -1;
+
 	struct ForceIntegrationCallbackData {
 		Callable callable;
 		Variant udata;
@@ -147,13 +157,43 @@ class GodotBody3D : public GodotCollisionObject3D {
 	uint64_t island_step = 0;
 
 	void _update_transform_dependent();
+	void _write_render_transform(bool p_teleport);
 
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
+	// Everything the solver carries from one step to the next, used to save and restore spaces.
+	struct SimulationState {
+		Transform3D transform;
+		Transform3D new_transform;
+		Vector3 linear_velocity;
+		Vector3 constant_linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 constant_angular_velocity;
+		Vector3 applied_force;
+		Vector3 constant_force;
+		Vector3 applied_torque;
+		Vector3 constant_torque;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	struct StableOrder {
+		_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const { return p_a->get_self().get_id() < p_b->get_self().get_id(); }
+	};
+
+	void get_simulation_state(SimulationState &r_state) const;
+	void set_simulation_state(const SimulationState &p_state);
+
+	void shift_origin(const Vector3 &p_offset);
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
+	void set_render_instance(RID p_instance);
+	void set_render_multimesh(RID p_multimesh, int p_index);
+	_FORCE_INLINE_ bool has_render_target() const { return render_instance.is_valid() || render_multimesh.is_valid(); }
+
 	GodotPhysicsDirectBodyState3D *get_direct_state();
 
 	_FORCE_INLINE_ void add_area(GodotArea3D *p_area) {
@@ -317,8 +357,11 @@ public:
 	void set_axis_lock(PS3DE::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PS3DE::BodyAxis p_axis) const;
 
-	void integrate_forces(real_t p_step);
-	void integrate_velocities(real_t p_step);
+	// When `p_deferred` is true, only this body is modified so several bodies can be integrated on
+	// worker threads at once. The shared space state is then updated by `apply_deferred_integration()`.
+	void integrate_forces(real_t p_step, bool p_deferred = false);
+	void integrate_velocities(real_t p_step, bool p_deferred = false);
+	void apply_deferred_integration();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
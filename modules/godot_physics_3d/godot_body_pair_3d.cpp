@@ -597,6 +597,12 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodyPair3D::clear_cache() {
+	contact_count = 0;
+	sep_axis = Vector3();
+	collided = false;
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
@@ -974,6 +980,12 @@ void GodotBodySoftBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodySoftBodyPair3D::clear_cache() {
+	contacts.clear();
+	sep_axis = Vector3();
+	collided = false;
+}
+
 GodotBodySoftBodyPair3D::GodotBodySoftBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotSoftBody3D *p_B) :
 		GodotBodyContact3D(&body, 1) {
 	body = p_A;
@@ -157,6 +157,24 @@ void GodotCollisionObject3D::_update_shapes() {
 		return;
 	}
 
+	_compute_shapes_aabb();
+	_flush_shapes_to_broadphase();
+}
+
+void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion) {
+	if (!space) {
+		return;
+	}
+
+	_compute_shapes_aabb_with_motion(p_motion);
+	_flush_shapes_to_broadphase();
+}
+
+void GodotCollisionObject3D::_compute_shapes_aabb() {
+	if (!space) {
+		return;
+	}
+
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 		if (s.disabled) {
@@ -172,17 +190,10 @@ void GodotCollisionObject3D::_update_shapes() {
 
 		Vector3 scale = xform.get_basis().get_scale();
 		s.area_cache = s.shape->get_volume() * scale.x * scale.y * scale.z;
-
-		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
-			space->get_broadphase()->set_static(s.bpid, _static);
-		}
-
-		space->get_broadphase()->move(s.bpid, shape_aabb);
 	}
 }
 
-void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion) {
+void GodotCollisionObject3D::_compute_shapes_aabb_with_motion(const Vector3 &p_motion) {
 	if (!space) {
 		return;
 	}
@@ -199,13 +210,26 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 		shape_aabb = xform.xform(shape_aabb);
 		shape_aabb.merge_with(AABB(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
 		s.aabb_cache = shape_aabb;
+	}
+}
+
+void GodotCollisionObject3D::_flush_shapes_to_broadphase() {
+	if (!space) {
+		return;
+	}
+
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
+		}
 
 		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
 }
 
@@ -81,6 +81,12 @@ private:
 
 protected:
 	void _update_shapes_with_motion(const Vector3 &p_motion);
+
+	// Split versions of the shape updates above: the AABB computation only touches this object
+	// and can run on worker threads, the broadphase flush must then happen on a single thread.
+	void _compute_shapes_aabb();
+	void _compute_shapes_aabb_with_motion(const Vector3 &p_motion);
+	void _flush_shapes_to_broadphase();
 	void _unregister_shapes();
 
 	_FORCE_INLINE_ void _set_transform(const Transform3D &p_transform, bool p_update_shapes = true) {
@@ -77,5 +77,8 @@ public:
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	// Drops what the constraint keeps from one step to the next, like the accumulated impulses of contacts used for warm starting.
+	virtual void clear_cache() {}
+
 	virtual ~GodotConstraint3D() {}
 };
@@ -214,6 +214,26 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+Vector<uint8_t> GodotPhysicsServer3D::space_save_state(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), Vector<uint8_t>(), "Space state can't be saved while the space is being stepped.");
+	return space->save_state();
+}
+
+bool GodotPhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	return space->restore_state(p_state);
+}
+
+void GodotPhysicsServer3D::space_shift_origin(RID p_space, const Vector3 &p_offset) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	ERR_FAIL_COND_MSG(space->is_locked(), "Space origin can't be shifted while the space is being stepped.");
+	space->shift_origin(p_offset);
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -931,6 +951,19 @@ void GodotPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_force_integration_callback(p_callable, p_udata);
 }
 
+void GodotPhysicsServer3D::body_set_render_instance(RID p_body, RID p_instance) {
+	GodotBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	body->set_render_instance(p_instance);
+}
+
+void GodotPhysicsServer3D::body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index) {
+	GodotBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	ERR_FAIL_COND(p_multimesh.is_valid() && p_index < 0);
+	body->set_render_multimesh(p_multimesh, p_index);
+}
+
 void GodotPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	GodotBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
@@ -1700,11 +1733,13 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	broadphase_time = 0;
 	for (GodotSpace3D *E : active_spaces) {
 		stepper->step(E, p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+		broadphase_time += E->get_elapsed_time(GodotSpace3D::ELAPSED_TIME_BROADPHASE);
 	}
 }
 
@@ -1735,7 +1770,8 @@ void GodotPhysicsServer3D::flush_queries() {
 			"generate_islands",
 			"setup_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"broadphase"
 		};
 
 		for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
@@ -1781,6 +1817,9 @@ int GodotPhysicsServer3D::get_process_info(PS3DE::ProcessInfo p_info) {
 		case PS3DE::INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case PS3DE::INFO_BROADPHASE_TIME: {
+			return broadphase_time;
+		} break;
 	}
 
 	return 0;
@@ -813,8 +813,6 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		return;
 	}
 
-	const Vector3 *vrts = &mesh.vertices[0];
-
 	if (vertex_count > 3 * extreme_vertices.size()) {
 		// For a large mesh, two calls to get_support() is faster than a full
 		// scan over all vertices.
@@ -823,17 +821,76 @@ void GodotConvexPolygonShape3D::project_range(const Vector3 &p_normal, const Tra
 		r_min = p_normal.dot(p_transform.xform(get_support(-n)));
 		r_max = p_normal.dot(p_transform.xform(get_support(n)));
 	} else {
-		for (uint32_t i = 0; i < vertex_count; i++) {
-			real_t d = p_normal.dot(p_transform.xform(vrts[i]));
+		// Project the axis into local space once, instead of transforming every vertex.
+		Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+		real_t offset = p_normal.dot(p_transform.origin);
 
-			if (i == 0 || d > r_max) {
-				r_max = d;
-			}
-			if (i == 0 || d < r_min) {
-				r_min = d;
-			}
+		_scan_range(local_normal, r_min, r_max);
+		r_min += offset;
+		r_max += offset;
+	}
+}
+
+void GodotConvexPolygonShape3D::_scan_range(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const {
+	const real_t *xs = vertices_x.ptr();
+	const real_t *ys = vertices_y.ptr();
+	const real_t *zs = vertices_z.ptr();
+	uint32_t padded_count = vertices_x.size();
+
+	real_t lane_min[SUPPORT_LANES];
+	real_t lane_max[SUPPORT_LANES];
+	for (uint32_t l = 0; l < SUPPORT_LANES; l++) {
+		lane_min[l] = p_normal.x * xs[l] + p_normal.y * ys[l] + p_normal.z * zs[l];
+		lane_max[l] = lane_min[l];
+	}
+
+	for (uint32_t i = SUPPORT_LANES; i < padded_count; i += SUPPORT_LANES) {
+		for (uint32_t l = 0; l < SUPPORT_LANES; l++) {
+			real_t d = p_normal.x * xs[i + l] + p_normal.y * ys[i + l] + p_normal.z * zs[i + l];
+			lane_min[l] = d < lane_min[l] ? d : lane_min[l];
+			lane_max[l] = d > lane_max[l] ? d : lane_max[l];
 		}
 	}
+
+	r_min = lane_min[0];
+	r_max = lane_max[0];
+	for (uint32_t l = 1; l < SUPPORT_LANES; l++) {
+		r_min = MIN(r_min, lane_min[l]);
+		r_max = MAX(r_max, lane_max[l]);
+	}
+}
+
+uint32_t GodotConvexPolygonShape3D::_scan_support(const Vector3 &p_normal) const {
+	const real_t *xs = vertices_x.ptr();
+	const real_t *ys = vertices_y.ptr();
+	const real_t *zs = vertices_z.ptr();
+	uint32_t padded_count = vertices_x.size();
+
+	real_t lane_max[SUPPORT_LANES];
+	uint32_t lane_index[SUPPORT_LANES];
+	for (uint32_t l = 0; l < SUPPORT_LANES; l++) {
+		lane_max[l] = p_normal.x * xs[l] + p_normal.y * ys[l] + p_normal.z * zs[l];
+		lane_index[l] = l;
+	}
+
+	for (uint32_t i = SUPPORT_LANES; i < padded_count; i += SUPPORT_LANES) {
+		for (uint32_t l = 0; l < SUPPORT_LANES; l++) {
+			real_t d = p_normal.x * xs[i + l] + p_normal.y * ys[i + l] + p_normal.z * zs[i + l];
+			bool better = d > lane_max[l];
+			lane_max[l] = better ? d : lane_max[l];
+			lane_index[l] = better ? i + l : lane_index[l];
+		}
+	}
+
+	uint32_t best = 0;
+	for (uint32_t l = 1; l < SUPPORT_LANES; l++) {
+		if (lane_max[l] > lane_max[best] || (lane_max[l] == lane_max[best] && lane_index[l] < lane_index[best])) {
+			best = l;
+		}
+	}
+
+	// Padding repeats the last vertex, so clamp back to a real index.
+	return MIN(lane_index[best], mesh.vertices.size() - 1);
 }
 
 Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
@@ -845,6 +902,11 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 	// Get the array of vertices
 	const Vector3 *const vertices_array = mesh.vertices.ptr();
 
+	// Small hulls have every vertex extreme, scanning them all at once is faster than a walk.
+	if (extreme_vertices.size() == mesh.vertices.size()) {
+		return vertices_array[_scan_support(p_normal)];
+	}
+
 	// Start with an initial assumption of the first extreme vertex.
 	int best_vertex = extreme_vertices[0];
 	real_t max_support = p_normal.dot(vertices_array[best_vertex]);
@@ -858,11 +920,6 @@ Vector3 GodotConvexPolygonShape3D::get_support(const Vector3 &p_normal) const {
 		}
 	}
 
-	// If we checked all vertices in the mesh then we're done.
-	if (extreme_vertices.size() == mesh.vertices.size()) {
-		return vertices_array[best_vertex];
-	}
-
 	// Move along the surface until we reach the true support vertex.
 	int last_vertex = -1;
 	while (true) {
@@ -1086,6 +1143,18 @@ void GodotConvexPolygonShape3D::_setup(const Vector<Vector3> &p_vertices) {
 	extreme_vertices.resize(0);
 	vertex_neighbors.resize(0);
 
+	uint32_t vertex_count = mesh.vertices.size();
+	uint32_t padded_count = vertex_count == 0 ? 0 : (vertex_count + SUPPORT_LANES - 1) / SUPPORT_LANES * SUPPORT_LANES;
+	vertices_x.resize(padded_count);
+	vertices_y.resize(padded_count);
+	vertices_z.resize(padded_count);
+	for (uint32_t i = 0; i < padded_count; i++) {
+		const Vector3 &v = mesh.vertices[MIN(i, vertex_count - 1)];
+		vertices_x[i] = v.x;
+		vertices_y[i] = v.y;
+		vertices_z[i] = v.z;
+	}
+
 	AABB _aabb;
 
 	for (uint32_t i = 0; i < mesh.vertices.size(); i++) {
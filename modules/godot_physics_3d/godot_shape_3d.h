@@ -282,7 +282,16 @@ struct GodotConvexPolygonShape3D : public GodotShape3D {
 	LocalVector<int> extreme_vertices;
 	LocalVector<LocalVector<int>> vertex_neighbors;
 
+	// Vertex coordinates split per axis and padded to a multiple of SUPPORT_LANES, so full scans
+	// over the hull test several vertices at once and can be vectorized by the compiler.
+	static constexpr uint32_t SUPPORT_LANES = 4;
+	LocalVector<real_t> vertices_x;
+	LocalVector<real_t> vertices_y;
+	LocalVector<real_t> vertices_z;
+
 	void _setup(const Vector<Vector3> &p_vertices);
+	void _scan_range(const Vector3 &p_normal, real_t &r_min, real_t &r_max) const;
+	uint32_t _scan_support(const Vector3 &p_normal) const;
 
 public:
 	const Geometry3D::MeshData &get_mesh() const { return mesh; }
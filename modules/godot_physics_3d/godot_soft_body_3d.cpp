@@ -195,17 +195,13 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
-void GodotSoftBody3D::update_bounds() {
+void GodotSoftBody3D::update_bounds(bool p_deferred) {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
 	bounds = AABB();
 
 	const uint32_t nodes_count = nodes.size();
-	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
-	}
 
 	bool first = true;
 	bool moved = false;
@@ -222,8 +218,20 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
-	if (get_space()) {
-		initialize_shape(moved);
+	if (p_deferred) {
+		deferred_shape_update = true;
+		deferred_shape_moved = moved;
+		return;
+	}
+
+	update_shape(moved);
+}
+
+void GodotSoftBody3D::update_shape(bool p_moved) {
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+	} else if (get_space()) {
+		initialize_shape(p_moved);
 	}
 }
 
@@ -318,6 +326,35 @@ void GodotSoftBody3D::apply_nodes_transform(const Transform3D &p_transform) {
 	update_constants();
 }
 
+void GodotSoftBody3D::shift_origin(const Vector3 &p_offset) {
+	Transform3D shifted_transform = get_transform();
+	shifted_transform.origin -= p_offset;
+	_set_transform(shifted_transform, false);
+	_set_inv_transform(shifted_transform.affine_inverse());
+
+	if (soft_mesh.is_null()) {
+		return;
+	}
+
+	// Unlike `apply_nodes_transform()`, velocities are kept so the simulation carries on unaffected.
+	uint32_t node_count = nodes.size();
+	Vector3 leaf_size = Vector3(collision_margin, collision_margin, collision_margin) * 2.0;
+	for (uint32_t node_index = 0; node_index < node_count; ++node_index) {
+		Node &node = nodes[node_index];
+
+		node.x -= p_offset;
+		node.q -= p_offset;
+
+		AABB node_aabb(node.x, leaf_size);
+		node_tree.update(node.leaf, node_aabb);
+	}
+
+	face_tree.clear();
+
+	update_normals_and_centroids();
+	update_bounds();
+}
+
 Vector3 GodotSoftBody3D::get_vertex_position(int p_index) const {
 	ERR_FAIL_COND_V(p_index < 0, Vector3());
 
@@ -1004,7 +1041,7 @@ Vector3 GodotSoftBody3D::_compute_area_windforce(const GodotArea3D *p_area, cons
 	return nodal_force_magnitude * p_face->normal;
 }
 
-void GodotSoftBody3D::predict_motion(real_t p_delta) {
+void GodotSoftBody3D::predict_motion(real_t p_delta, bool p_deferred) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	ERR_FAIL_NULL(get_space());
@@ -1081,7 +1118,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	}
 
 	// Bounds and tree update.
-	update_bounds();
+	update_bounds(p_deferred);
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1102,6 +1139,13 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
+void GodotSoftBody3D::apply_deferred_motion() {
+	if (deferred_shape_update) {
+		deferred_shape_update = false;
+		update_shape(deferred_shape_moved);
+	}
+}
+
 void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	const real_t inv_delta = 1.0 / p_delta;
 
@@ -112,6 +112,10 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 
 	uint64_t island_step = 0;
 
+	// Space updates postponed by a deferred motion prediction, see `apply_deferred_motion()`.
+	bool deferred_shape_update = false;
+	bool deferred_shape_moved = false;
+
 	_FORCE_INLINE_ Vector3 _compute_area_windforce(const GodotArea3D *p_area, const Face *p_face);
 
 public:
@@ -122,6 +126,8 @@ public:
 	void set_state(PS3DE::BodyState p_state, const Variant &p_variant);
 	Variant get_state(PS3DE::BodyState p_state) const;
 
+	void shift_origin(const Vector3 &p_offset);
+
 	_FORCE_INLINE_ void add_constraint(GodotConstraint3D *p_constraint) { constraints.insert(p_constraint); }
 	_FORCE_INLINE_ void remove_constraint(GodotConstraint3D *p_constraint) { constraints.erase(p_constraint); }
 	_FORCE_INLINE_ const HashSet<GodotConstraint3D *> &get_constraints() const { return constraints; }
@@ -208,7 +214,9 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
-	void predict_motion(real_t p_delta);
+	// With `p_deferred`, only this soft body is touched, so bodies can be predicted on threads. `apply_deferred_motion()` must then be called before the broadphase is updated.
+	void predict_motion(real_t p_delta, bool p_deferred = false);
+	void apply_deferred_motion();
 	void solve_constraints(real_t p_delta);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
@@ -226,7 +234,8 @@ protected:
 
 private:
 	void update_normals_and_centroids();
-	void update_bounds();
+	void update_bounds(bool p_deferred = false);
+	void update_shape(bool p_moved);
 	void update_constants();
 	void update_area();
 	void reset_link_rest_lengths();
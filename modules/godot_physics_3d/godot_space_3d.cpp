@@ -40,6 +40,13 @@
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
+struct GodotPhysicsDirectSpaceState3D::QueryBuffers {
+	GodotCollisionObject3D *results[GodotSpace3D::INTERSECTION_QUERY_MAX];
+	int subindex_results[GodotSpace3D::INTERSECTION_QUERY_MAX];
+};
+
+thread_local GodotPhysicsDirectSpaceState3D::QueryBuffers *GodotPhysicsDirectSpaceState3D::batch_query_buffers = nullptr;
+
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject3D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -116,7 +123,10 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const PS3DT::RayParameters &p
 	end = p_parameters.to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = batch_query_buffers ? batch_query_buffers->results : space->intersection_query_results;
+	int *query_subindex_results = batch_query_buffers ? batch_query_buffers->subindex_results : space->intersection_query_subindex_results;
+
+	int amount = space->broadphase->cull_segment(begin, end, query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, query_subindex_results);
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -128,21 +138,21 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const PS3DT::RayParameters &p
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(query_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = query_subindex_results[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -217,7 +227,10 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const PS3DT::ShapeParameters
 
 	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	GodotCollisionObject3D **query_results = batch_query_buffers ? batch_query_buffers->results : space->intersection_query_results;
+	int *query_subindex_results = batch_query_buffers ? batch_query_buffers->subindex_results : space->intersection_query_subindex_results;
+
+	int amount = space->broadphase->cull_aabb(aabb, query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, query_subindex_results);
 
 	int cc = 0;
 
@@ -228,18 +241,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const PS3DT::ShapeParameters
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(query_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = query_results[i];
+		int shape_idx = query_subindex_results[i];
 
 		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
@@ -611,6 +624,16 @@ Vector3 GodotPhysicsDirectSpaceState3D::get_closest_point_to_object_volume(RID p
 	}
 }
 
+void GodotPhysicsDirectSpaceState3D::_batch_queries_begin() {
+	// Only ray and shape intersections are batched, the other queries keep using the space's buffers.
+	batch_query_buffers = memnew(QueryBuffers);
+}
+
+void GodotPhysicsDirectSpaceState3D::_batch_queries_end() {
+	memdelete(batch_query_buffers);
+	batch_query_buffers = nullptr;
+}
+
 GodotPhysicsDirectSpaceState3D::GodotPhysicsDirectSpaceState3D() {
 	space = nullptr;
 }
@@ -1124,7 +1147,10 @@ const HashSet<GodotCollisionObject3D *> &GodotSpace3D::get_objects() const {
 }
 
 void GodotSpace3D::body_add_to_state_query_list(SelfList<GodotBody3D> *p_body) {
-	state_query_list.add(p_body);
+	// Restoring a state may already have queued the body before it is stepped.
+	if (!p_body->in_list()) {
+		state_query_list.add(p_body);
+	}
 }
 
 void GodotSpace3D::body_remove_from_state_query_list(SelfList<GodotBody3D> *p_body) {
@@ -1252,6 +1278,172 @@ bool GodotSpace3D::is_locked() const {
 	return locked;
 }
 
+#define STATE_MAGIC 0x44335347 // "GS3D"
+#define STATE_VERSION 1
+#define STATE_HEADER_SIZE (4 * sizeof(uint32_t))
+#define STATE_BODY_REALS 49
+#define STATE_BODY_SIZE (sizeof(uint64_t) + STATE_BODY_REALS * sizeof(real_t) + 1)
+
+static _FORCE_INLINE_ void _state_write_real(uint8_t *&w, real_t p_value) {
+	memcpy(w, &p_value, sizeof(real_t));
+	w += sizeof(real_t);
+}
+
+static _FORCE_INLINE_ void _state_write_vector3(uint8_t *&w, const Vector3 &p_value) {
+	for (int i = 0; i < 3; i++) {
+		_state_write_real(w, p_value[i]);
+	}
+}
+
+static _FORCE_INLINE_ void _state_write_transform(uint8_t *&w, const Transform3D &p_value) {
+	for (int i = 0; i < 3; i++) {
+		_state_write_vector3(w, p_value.basis.rows[i]);
+	}
+	_state_write_vector3(w, p_value.origin);
+}
+
+static _FORCE_INLINE_ real_t _state_read_real(const uint8_t *&r) {
+	real_t value;
+	memcpy(&value, r, sizeof(real_t));
+	r += sizeof(real_t);
+	return value;
+}
+
+static _FORCE_INLINE_ Vector3 _state_read_vector3(const uint8_t *&r) {
+	Vector3 value;
+	for (int i = 0; i < 3; i++) {
+		value[i] = _state_read_real(r);
+	}
+	return value;
+}
+
+static _FORCE_INLINE_ Transform3D _state_read_transform(const uint8_t *&r) {
+	Transform3D xform;
+	for (int i = 0; i < 3; i++) {
+		xform.basis.rows[i] = _state_read_vector3(r);
+	}
+	xform.origin = _state_read_vector3(r);
+	return xform;
+}
+
+Vector<uint8_t> GodotSpace3D::save_state() const {
+	LocalVector<GodotBody3D *> bodies;
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.push_back(static_cast<GodotBody3D *>(E));
+		}
+	}
+	bodies.sort_custom<GodotBody3D::StableOrder>();
+
+	Vector<uint8_t> state;
+	state.resize(STATE_HEADER_SIZE + bodies.size() * STATE_BODY_SIZE);
+	uint8_t *w = state.ptrw();
+
+	const uint32_t header[4] = { STATE_MAGIC, STATE_VERSION, (uint32_t)sizeof(real_t), bodies.size() };
+	memcpy(w, header, STATE_HEADER_SIZE);
+	w += STATE_HEADER_SIZE;
+
+	GodotBody3D::SimulationState body_state;
+	for (const GodotBody3D *body : bodies) {
+		body->get_simulation_state(body_state);
+
+		const uint64_t id = body->get_self().get_id();
+		memcpy(w, &id, sizeof(uint64_t));
+		w += sizeof(uint64_t);
+
+		_state_write_transform(w, body_state.transform);
+		_state_write_transform(w, body_state.new_transform);
+		_state_write_vector3(w, body_state.linear_velocity);
+		_state_write_vector3(w, body_state.constant_linear_velocity);
+		_state_write_vector3(w, body_state.angular_velocity);
+		_state_write_vector3(w, body_state.constant_angular_velocity);
+		_state_write_vector3(w, body_state.applied_force);
+		_state_write_vector3(w, body_state.constant_force);
+		_state_write_vector3(w, body_state.applied_torque);
+		_state_write_vector3(w, body_state.constant_torque);
+		_state_write_real(w, body_state.still_time);
+		*w++ = body_state.active ? 1 : 0;
+	}
+
+	return state;
+}
+
+bool GodotSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(locked, false, "Space state can't be restored while the space is being stepped.");
+	ERR_FAIL_COND_V_MSG(p_state.size() < (int64_t)STATE_HEADER_SIZE, false, "Invalid space state.");
+
+	const uint8_t *r = p_state.ptr();
+	uint32_t header[4];
+	memcpy(header, r, STATE_HEADER_SIZE);
+	r += STATE_HEADER_SIZE;
+
+	ERR_FAIL_COND_V_MSG(header[0] != STATE_MAGIC || header[1] != STATE_VERSION, false, "Invalid space state.");
+	ERR_FAIL_COND_V_MSG(header[2] != sizeof(real_t), false, "Space state was saved with a different floating-point precision.");
+	ERR_FAIL_COND_V_MSG(p_state.size() != (int64_t)(STATE_HEADER_SIZE + header[3] * STATE_BODY_SIZE), false, "Invalid space state.");
+
+	HashMap<uint64_t, GodotBody3D *> bodies;
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	GodotBody3D::SimulationState body_state;
+	for (uint32_t i = 0; i < header[3]; i++) {
+		uint64_t id;
+		memcpy(&id, r, sizeof(uint64_t));
+		r += sizeof(uint64_t);
+
+		body_state.transform = _state_read_transform(r);
+		body_state.new_transform = _state_read_transform(r);
+		body_state.linear_velocity = _state_read_vector3(r);
+		body_state.constant_linear_velocity = _state_read_vector3(r);
+		body_state.angular_velocity = _state_read_vector3(r);
+		body_state.constant_angular_velocity = _state_read_vector3(r);
+		body_state.applied_force = _state_read_vector3(r);
+		body_state.constant_force = _state_read_vector3(r);
+		body_state.applied_torque = _state_read_vector3(r);
+		body_state.constant_torque = _state_read_vector3(r);
+		body_state.still_time = _state_read_real(r);
+		body_state.active = *r++ != 0;
+
+		// Bodies removed since the state was saved are skipped, bodies added since keep their current state.
+		GodotBody3D **body = bodies.getptr(id);
+		if (body) {
+			(*body)->set_simulation_state(body_state);
+		}
+	}
+
+	// Contacts aren't part of the state. Those of the abandoned timeline would warm start the solver
+	// with impulses that don't match the restored bodies, so start over from none.
+	for (const KeyValue<uint64_t, GodotBody3D *> &E : bodies) {
+		for (const KeyValue<GodotConstraint3D *, int> &F : E.value->get_constraint_map()) {
+			F.key->clear_cache();
+		}
+	}
+
+	return true;
+}
+
+void GodotSpace3D::shift_origin(const Vector3 &p_offset) {
+	for (GodotCollisionObject3D *object : objects) {
+		switch (object->get_type()) {
+			case GodotCollisionObject3D::TYPE_BODY: {
+				static_cast<GodotBody3D *>(object)->shift_origin(p_offset);
+			} break;
+			case GodotCollisionObject3D::TYPE_AREA: {
+				GodotArea3D *area = static_cast<GodotArea3D *>(object);
+				Transform3D transform = area->get_transform();
+				transform.origin -= p_offset;
+				area->set_transform(transform);
+			} break;
+			case GodotCollisionObject3D::TYPE_SOFT_BODY: {
+				static_cast<GodotSoftBody3D *>(object)->shift_origin(p_offset);
+			} break;
+		}
+	}
+}
+
 GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
@@ -42,6 +42,16 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	struct QueryBuffers;
+
+	// Set on threads running batched queries, so they don't share the space's broadphase result buffers.
+	thread_local static QueryBuffers *batch_query_buffers;
+
+protected:
+	virtual bool _is_batch_parallel_safe() const override { return true; }
+	virtual void _batch_queries_begin() override;
+	virtual void _batch_queries_end() override;
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -64,6 +74,7 @@ public:
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_INTEGRATE_VELOCITIES,
+		ELAPSED_TIME_BROADPHASE,
 		ELAPSED_TIME_MAX
 
 	};
@@ -205,6 +216,11 @@ public:
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
+	Vector<uint8_t> save_state() const;
+	bool restore_state(const Vector<uint8_t> &p_state);
+
+	void shift_origin(const Vector3 &p_offset);
+
 	bool test_body_motion(GodotBody3D *p_body, const PS3DT::MotionParameters &p_parameters, PS3DT::MotionResult *r_result);
 
 	GodotSpace3D();
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  test_godot_physics_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/object/callable_mp.h"
+#include "servers/physics_3d/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics3D {
+
+class StateSyncMock : public Object {
+	GDCLASS(StateSyncMock, Object);
+
+public:
+	void state_changed(PhysicsDirectBodyState3D *p_state) {
+		calls++;
+		transform = p_state->get_transform();
+	}
+
+	unsigned calls = 0;
+	Transform3D transform;
+};
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Restoring a state should sync sleeping bodies") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	physics_server->set_active(true);
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID shape = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(shape, 0.5);
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PS3DE::BODY_MODE_RIGID);
+	physics_server->body_add_shape(body, shape);
+	physics_server->body_set_space(body, space);
+
+	StateSyncMock mock;
+	physics_server->body_set_state_sync_callback(body, callable_mp(&mock, &StateSyncMock::state_changed));
+
+	const Transform3D sleeping_transform(Basis(), Vector3(1, 2, 3));
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_TRANSFORM, sleeping_transform);
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_SLEEPING, true);
+	const Vector<uint8_t> saved_state = physics_server->space_save_state(space);
+	REQUIRE_FALSE(saved_state.is_empty());
+
+	// Wake the body up and move it away.
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_SLEEPING, false);
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_LINEAR_VELOCITY, Vector3(0, -5, 0));
+	physics_server->step(1.0 / 60.0);
+	physics_server->flush_queries();
+	REQUIRE_NE(Transform3D(physics_server->body_get_state(body, PS3DE::BODY_STATE_TRANSFORM)), sleeping_transform);
+
+	mock.calls = 0;
+	CHECK(physics_server->space_restore_state(space, saved_state));
+	CHECK_EQ(Transform3D(physics_server->body_get_state(body, PS3DE::BODY_STATE_TRANSFORM)), sleeping_transform);
+	CHECK(bool(physics_server->body_get_state(body, PS3DE::BODY_STATE_SLEEPING)));
+
+	physics_server->flush_queries();
+	CHECK_MESSAGE(mock.calls == 1, "The restored sleeping body should be synchronized once.");
+	CHECK_EQ(mock.transform, sleeping_transform);
+
+	// Stepping should leave the restored sleeping body where it is.
+	CHECK(physics_server->space_restore_state(space, saved_state));
+	physics_server->step(1.0 / 60.0);
+	physics_server->flush_queries();
+	CHECK_EQ(Transform3D(physics_server->body_get_state(body, PS3DE::BODY_STATE_TRANSFORM)), sleeping_transform);
+	CHECK_EQ(mock.transform, sleeping_transform);
+
+	physics_server->free_rid(body);
+	physics_server->free_rid(shape);
+	physics_server->free_rid(space);
+
+	physics_server->set_active(false);
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Steps replayed from a restored state should be repeatable") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	physics_server->set_active(true);
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID floor_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector3(5, 0.5, 5));
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PS3DE::BODY_MODE_STATIC);
+	physics_server->body_add_shape(floor, floor_shape);
+	physics_server->body_set_space(floor, space);
+
+	RID shape = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(shape, 0.5);
+	RID body = physics_server->body_create();
+	physics_server->body_set_mode(body, PS3DE::BODY_MODE_RIGID);
+	physics_server->body_add_shape(body, shape);
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_CAN_SLEEP, false);
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 1, 0)));
+	physics_server->body_set_state(body, PS3DE::BODY_STATE_LINEAR_VELOCITY, Vector3(0.5, -1, 0));
+	physics_server->body_set_space(body, space);
+
+	// Let the sphere land, so that its contact with the floor has accumulated impulses when the state is saved.
+	for (int i = 0; i < 10; i++) {
+		physics_server->step(1.0 / 60.0);
+		physics_server->flush_queries();
+	}
+	const Vector<uint8_t> saved_state = physics_server->space_save_state(space);
+	REQUIRE_FALSE(saved_state.is_empty());
+
+	// Each replay must not warm start from the contacts the previous one ended with.
+	Transform3D replayed_transforms[2];
+	Vector3 replayed_velocities[2];
+	for (int replay = 0; replay < 2; replay++) {
+		CHECK(physics_server->space_restore_state(space, saved_state));
+		for (int i = 0; i < 10; i++) {
+			physics_server->step(1.0 / 60.0);
+			physics_server->flush_queries();
+		}
+		replayed_transforms[replay] = physics_server->body_get_state(body, PS3DE::BODY_STATE_TRANSFORM);
+		replayed_velocities[replay] = physics_server->body_get_state(body, PS3DE::BODY_STATE_LINEAR_VELOCITY);
+	}
+	CHECK_EQ(replayed_transforms[0], replayed_transforms[1]);
+	CHECK_EQ(replayed_velocities[0], replayed_velocities[1]);
+
+	physics_server->free_rid(body);
+	physics_server->free_rid(shape);
+	physics_server->free_rid(floor);
+	physics_server->free_rid(floor_shape);
+	physics_server->free_rid(space);
+
+	physics_server->set_active(false);
+}
+
+} // namespace TestGodotPhysics3D
@@ -267,6 +267,27 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+Vector<uint8_t> JoltPhysicsServer3D::space_save_state(RID p_space) const {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+
+	return space->save_state();
+}
+
+bool JoltPhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+
+	return space->restore_state(p_state);
+}
+
+void JoltPhysicsServer3D::space_shift_origin(RID p_space, const Vector3 &p_offset) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->shift_origin(p_offset);
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -948,6 +969,21 @@ void JoltPhysicsServer3D::body_set_force_integration_callback(RID p_body, const
 	body->set_custom_integration_callback(p_callable, p_userdata);
 }
 
+void JoltPhysicsServer3D::body_set_render_instance(RID p_body, RID p_instance) {
+	JoltBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_render_instance(p_instance);
+}
+
+void JoltPhysicsServer3D::body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index) {
+	JoltBody3D *body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+	ERR_FAIL_COND(p_multimesh.is_valid() && p_index < 0);
+
+	body->set_render_multimesh(p_multimesh, p_index);
+}
+
 void JoltPhysicsServer3D::body_set_ray_pickable(RID p_body, bool p_enable) {
 	JoltBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
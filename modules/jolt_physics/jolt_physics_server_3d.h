@@ -162,6 +162,10 @@ public:
 	virtual PackedVector3Array space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) const override;
+	virtual bool space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override;
+	virtual void space_shift_origin(RID p_space, const Vector3 &p_offset) override;
+
 	virtual RID area_create() override;
 
 	virtual void area_set_space(RID p_area, RID p_space) override;
@@ -292,6 +296,9 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_userdata) override;
 
+	virtual void body_set_render_instance(RID p_body, RID p_instance) override;
+	virtual void body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index) override;
+
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
 	virtual bool body_test_motion(RID p_body, const PS3DT::MotionParameters &p_parameters, PS3DT::MotionResult *r_result) override;
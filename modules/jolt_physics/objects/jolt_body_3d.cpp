@@ -43,6 +43,7 @@
 #include "jolt_soft_body_3d.h"
 
 #include "servers/physics_3d/physics_server_3d_constants.h"
+#include "servers/rendering/rendering_server.h"
 
 JPH::BroadPhaseLayer JoltBody3D::_get_broad_phase_layer() const {
 	switch (mode) {
@@ -477,6 +478,27 @@ void JoltBody3D::_joints_changed() {
 	wake_up();
 }
 
+void JoltBody3D::_write_render_transform(bool p_teleport) {
+	RenderingServer *rendering_server = RenderingServer::get_singleton();
+	const Transform3D transform = get_transform_scaled();
+
+	if (render_instance.is_valid()) {
+		rendering_server->instance_set_transform(render_instance, transform);
+
+		if (p_teleport) {
+			rendering_server->instance_teleport(render_instance);
+		}
+	}
+
+	if (render_multimesh.is_valid()) {
+		rendering_server->multimesh_instance_set_transform(render_multimesh, render_multimesh_index, transform);
+
+		if (p_teleport) {
+			rendering_server->multimesh_instance_reset_physics_interpolation(render_multimesh, render_multimesh_index);
+		}
+	}
+}
+
 void JoltBody3D::_transform_changed() {
 	wake_up();
 }
@@ -539,6 +561,10 @@ void JoltBody3D::set_transform(Transform3D p_transform) {
 	}
 
 	_transform_changed();
+
+	if (!is_kinematic() && has_render_target()) {
+		_write_render_transform(true);
+	}
 }
 
 Variant JoltBody3D::get_state(PS3DE::BodyState p_state) const {
@@ -663,6 +689,23 @@ void JoltBody3D::set_param(PS3DE::BodyParameter p_param, const Variant &p_value)
 	}
 }
 
+void JoltBody3D::set_render_instance(RID p_instance) {
+	render_instance = p_instance;
+
+	if (render_instance.is_valid()) {
+		_write_render_transform(true);
+	}
+}
+
+void JoltBody3D::set_render_multimesh(RID p_multimesh, int p_index) {
+	render_multimesh = p_multimesh;
+	render_multimesh_index = p_index;
+
+	if (render_multimesh.is_valid()) {
+		_write_render_transform(true);
+	}
+}
+
 void JoltBody3D::set_custom_integrator(bool p_enabled) {
 	if (custom_integrator == p_enabled) {
 		return;
@@ -1074,6 +1117,10 @@ void JoltBody3D::remove_joint(JoltJoint3D *p_joint) {
 }
 
 void JoltBody3D::call_queries() {
+	if (has_render_target()) {
+		_write_render_transform(false);
+	}
+
 	if (!custom_integration_callback.is_null()) {
 		const Variant direct_state_variant = get_direct_state();
 		const Variant *args[2] = { &direct_state_variant, &custom_integration_userdata };
@@ -1114,6 +1161,26 @@ void JoltBody3D::call_queries() {
 	}
 }
 
+void JoltBody3D::state_restored() {
+	// The simulated state changed outside of a step, so the nodes need to be synchronized on the next flush.
+	if (_should_call_queries()) {
+		_enqueue_call_queries();
+	}
+
+	if (has_render_target()) {
+		_write_render_transform(true);
+	}
+}
+
+void JoltBody3D::origin_shifted(const Vector3 &p_offset) {
+	// Kinematic bodies would otherwise sweep back towards their old target on the next step.
+	kinematic_transform.origin -= p_offset;
+
+	if (has_render_target()) {
+		_write_render_transform(true);
+	}
+}
+
 void JoltBody3D::pre_step(float p_step) {
 	JoltObject3D::pre_step(p_step);
 
@@ -80,6 +80,11 @@ private:
 	Callable state_sync_callback;
 	Callable custom_integration_callback;
 
+	// Written to directly whenever the body moves, so bodies without a node don't need a state sync callback.
+	RID render_instance;
+	RID render_multimesh;
+	int render_multimesh_index = -1;
+
 	JoltPhysicsDirectBodyState3D *direct_state = nullptr;
 
 	PS3DE::BodyMode mode = PS3DE::BODY_MODE_RIGID;
@@ -113,10 +118,12 @@ private:
 
 	virtual void _add_to_space() override;
 
-	bool _should_call_queries() const { return !state_sync_callback.is_null() || !custom_integration_callback.is_null(); }
+	bool _should_call_queries() const { return !state_sync_callback.is_null() || !custom_integration_callback.is_null() || has_render_target(); }
 	void _enqueue_call_queries();
 	void _dequeue_call_queries();
 
+	void _write_render_transform(bool p_teleport);
+
 	void _integrate_forces(float p_step);
 	void _move_kinematic(float p_step);
 
@@ -174,6 +181,10 @@ public:
 		custom_integration_userdata = p_userdata;
 	}
 
+	bool has_render_target() const { return render_instance.is_valid() || render_multimesh.is_valid(); }
+	void set_render_instance(RID p_instance);
+	void set_render_multimesh(RID p_multimesh, int p_index);
+
 	bool has_custom_integrator() const { return custom_integrator; }
 	void set_custom_integrator(bool p_enabled);
 
@@ -249,6 +260,8 @@ public:
 	void remove_joint(JoltJoint3D *p_joint);
 
 	void call_queries();
+	void state_restored();
+	void origin_shifted(const Vector3 &p_offset);
 
 	virtual void pre_step(float p_step) override;
 
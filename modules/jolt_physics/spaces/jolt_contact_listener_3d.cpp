@@ -37,9 +37,24 @@
 #include "../objects/jolt_soft_body_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include <Jolt/Physics/Collision/EstimateCollisionResponse.h>
 #include <Jolt/Physics/SoftBody/SoftBodyManifold.h>
 
+template <typename F>
+void JoltContactListener3D::_write_thread_buffer(F p_write) {
+	// Worker threads each get their own buffer, while any other thread (like the one stepping the space) shares the first one.
+	const uint32_t buffer_index = (uint32_t)(WorkerThreadPool::get_singleton()->get_thread_index() + 1);
+
+	if (likely(buffer_index > 0 && buffer_index < thread_buffers.size())) {
+		p_write(thread_buffers[buffer_index]);
+	} else {
+		const MutexLock shared_lock(shared_buffer_mutex);
+		p_write(thread_buffers[0]);
+	}
+}
+
 void JoltContactListener3D::OnContactAdded(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::ContactManifold &p_manifold, JPH::ContactSettings &p_settings) {
 	_try_override_collision_response(p_body1, p_body2, p_settings);
 	_try_apply_surface_velocities(p_body1, p_body2, p_settings);
@@ -63,13 +78,8 @@ void JoltContactListener3D::OnContactPersisted(const JPH::Body &p_body1, const J
 }
 
 void JoltContactListener3D::OnContactRemoved(const JPH::SubShapeIDPair &p_shape_pair) {
-	if (_try_remove_contacts(p_shape_pair)) {
-		return;
-	}
-
-	if (_try_remove_area_overlap(p_shape_pair)) {
-		return;
-	}
+	// We can't access the bodies here, so whether this was an area overlap is only known once the events are flushed.
+	_add_area_event(p_shape_pair, AREA_EVENT_REMOVED);
 }
 
 JPH::SoftBodyValidateResult JoltContactListener3D::OnSoftBodyContactValidate(const JPH::Body &p_soft_body, const JPH::Body &p_other_body, JPH::SoftBodyContactSettings &p_settings) {
@@ -191,60 +201,64 @@ bool JoltContactListener3D::_try_add_contacts(const JPH::Body &p_jolt_body1, con
 
 	const JPH::SubShapeIDPair shape_pair(p_jolt_body1.GetID(), p_manifold.mSubShapeID1, p_jolt_body2.GetID(), p_manifold.mSubShapeID2);
 
-	Manifold &manifold = [&]() -> Manifold & {
-		const MutexLock write_lock(write_mutex);
-		return manifolds_by_shape_pair[shape_pair];
-	}();
-
-	if (unlikely(!manifold.contacts1.is_empty())) {
-		// CCD collisions can result in two contact callbacks for the same shape pair, one in the earlier discrete stage and one in the later CCD stage.
-		// We want the manifolds from the discrete stage, as the bodies still have their original velocities at that point, so we early-out if we've already stored something.
-		return false;
-	}
+	// CCD collisions can result in two contact callbacks for the same shape pair, one in the earlier discrete stage and one in the later CCD stage.
+	// We want the manifolds from the discrete stage, as the bodies still have their original velocities at that point, so we number these manifolds
+	// in the order they were reported and discard all but the first one when flushing.
+	const bool is_linear_cast1 = !p_jolt_body1.IsStatic() && p_jolt_body1.GetMotionProperties()->GetMotionQuality() == JPH::EMotionQuality::LinearCast;
+	const bool is_linear_cast2 = !p_jolt_body2.IsStatic() && p_jolt_body2.GetMotionProperties()->GetMotionQuality() == JPH::EMotionQuality::LinearCast;
+	const uint32_t order = is_linear_cast1 || is_linear_cast2 ? ordered_manifold_count.fetch_add(1, std::memory_order_relaxed) + 1 : 0;
 
 	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
 
-	manifold.contacts1.reserve((uint32_t)contact_count);
-	manifold.contacts2.reserve((uint32_t)contact_count);
-	manifold.depth = p_manifold.mPenetrationDepth;
-
 	JPH::CollisionEstimationResult collision;
 	JPH::EstimateCollisionResponse(p_jolt_body1, p_jolt_body2, p_manifold, collision, p_settings.mCombinedFriction, p_settings.mCombinedRestitution, JoltProjectSettings::bounce_velocity_threshold, 5);
 
 	const JPH::Vec3 friction_impulse1 = contact_count > 0 ? (collision.mTangent1 * collision.mFrictionImpulse1) / contact_count : JPH::Vec3::sZero();
 	const JPH::Vec3 friction_impulse2 = contact_count > 0 ? (collision.mTangent2 * collision.mFrictionImpulse2) / contact_count : JPH::Vec3::sZero();
 
-	for (JPH::uint i = 0; i < contact_count; ++i) {
-		const JPH::RVec3 relative_point1 = JPH::RVec3(p_manifold.mRelativeContactPointsOn1[i]);
-		const JPH::RVec3 relative_point2 = JPH::RVec3(p_manifold.mRelativeContactPointsOn2[i]);
-
-		const JPH::RVec3 world_point1 = p_manifold.mBaseOffset + relative_point1;
-		const JPH::RVec3 world_point2 = p_manifold.mBaseOffset + relative_point2;
-
-		const JPH::Vec3 velocity1 = p_jolt_body1.GetPointVelocity(world_point1);
-		const JPH::Vec3 velocity2 = p_jolt_body2.GetPointVelocity(world_point2);
-
-		const JPH::Vec3 contact_impulse = p_manifold.mWorldSpaceNormal * collision.mContactImpulse[i];
-		const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
-
-		Contact contact1;
-		contact1.point_self = to_godot(world_point1);
-		contact1.point_other = to_godot(world_point2);
-		contact1.normal = to_godot(-p_manifold.mWorldSpaceNormal);
-		contact1.velocity_self = to_godot(velocity1);
-		contact1.velocity_other = to_godot(velocity2);
-		contact1.impulse = to_godot(-combined_impulse);
-		manifold.contacts1.push_back(contact1);
-
-		Contact contact2;
-		contact2.point_self = to_godot(world_point2);
-		contact2.point_other = to_godot(world_point1);
-		contact2.normal = to_godot(p_manifold.mWorldSpaceNormal);
-		contact2.velocity_self = to_godot(velocity2);
-		contact2.velocity_other = to_godot(velocity1);
-		contact2.impulse = to_godot(combined_impulse);
-		manifold.contacts2.push_back(contact2);
-	}
+	_write_thread_buffer([&](ThreadBuffer &p_buffer) {
+		Manifold manifold;
+		manifold.shape_pair = shape_pair;
+		manifold.depth = p_manifold.mPenetrationDepth;
+		manifold.contact_offset = p_buffer.contacts.size();
+		manifold.contact_count = (uint32_t)contact_count;
+		manifold.order = order;
+		p_buffer.manifolds.push_back(manifold);
+
+		// The contacts for the first and second body are interleaved.
+		p_buffer.contacts.resize(manifold.contact_offset + manifold.contact_count * 2);
+		Contact *contacts = p_buffer.contacts.ptr() + manifold.contact_offset;
+
+		for (JPH::uint i = 0; i < contact_count; ++i) {
+			const JPH::RVec3 relative_point1 = JPH::RVec3(p_manifold.mRelativeContactPointsOn1[i]);
+			const JPH::RVec3 relative_point2 = JPH::RVec3(p_manifold.mRelativeContactPointsOn2[i]);
+
+			const JPH::RVec3 world_point1 = p_manifold.mBaseOffset + relative_point1;
+			const JPH::RVec3 world_point2 = p_manifold.mBaseOffset + relative_point2;
+
+			const JPH::Vec3 velocity1 = p_jolt_body1.GetPointVelocity(world_point1);
+			const JPH::Vec3 velocity2 = p_jolt_body2.GetPointVelocity(world_point2);
+
+			const JPH::Vec3 contact_impulse = p_manifold.mWorldSpaceNormal * collision.mContactImpulse[i];
+			const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
+
+			Contact &contact1 = contacts[i * 2 + 0];
+			contact1.point_self = to_godot(world_point1);
+			contact1.point_other = to_godot(world_point2);
+			contact1.normal = to_godot(-p_manifold.mWorldSpaceNormal);
+			contact1.velocity_self = to_godot(velocity1);
+			contact1.velocity_other = to_godot(velocity2);
+			contact1.impulse = to_godot(-combined_impulse);
+
+			Contact &contact2 = contacts[i * 2 + 1];
+			contact2.point_self = to_godot(world_point2);
+			contact2.point_other = to_godot(world_point1);
+			contact2.normal = to_godot(p_manifold.mWorldSpaceNormal);
+			contact2.velocity_self = to_godot(velocity2);
+			contact2.velocity_other = to_godot(velocity1);
+			contact2.impulse = to_godot(combined_impulse);
+		}
+	});
 
 	return true;
 }
@@ -285,29 +299,14 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(const JPH::Body &p_body1,
 	return true;
 }
 
-bool JoltContactListener3D::_try_remove_contacts(const JPH::SubShapeIDPair &p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-	return manifolds_by_shape_pair.erase(p_shape_pair);
-}
-
-bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair &p_shape_pair) {
-	const JPH::SubShapeIDPair swapped_shape_pair(p_shape_pair.GetBody2ID(), p_shape_pair.GetSubShapeID2(), p_shape_pair.GetBody1ID(), p_shape_pair.GetSubShapeID1());
+void JoltContactListener3D::_add_area_event(const JPH::SubShapeIDPair &p_shape_pair, AreaEventType p_type) {
+	AreaEvent event;
+	event.shape_pair = p_shape_pair;
+	event.type = p_type;
 
-	const MutexLock write_lock(write_mutex);
-
-	bool removed = false;
-
-	if (area_overlaps.erase(p_shape_pair)) {
-		area_exits.insert(p_shape_pair);
-		removed = true;
-	}
-
-	if (area_overlaps.erase(swapped_shape_pair)) {
-		area_exits.insert(swapped_shape_pair);
-		removed = true;
-	}
-
-	return removed;
+	_write_thread_buffer([&](ThreadBuffer &p_buffer) {
+		p_buffer.area_events.push_back(event);
+	});
 }
 
 #ifdef DEBUG_ENABLED
@@ -403,80 +402,141 @@ bool JoltContactListener3D::_has_shape_shifted(const JoltShapedObject3D &p_objec
 }
 
 void JoltContactListener3D::_evaluate_area_overlap(const JoltArea3D &p_area, const JoltArea3D &p_other_area, const JPH::SubShapeIDPair &p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-
-	if (p_area.can_monitor(p_other_area)) {
-		if (!area_overlaps.has(p_shape_pair)) {
-			area_overlaps.insert(p_shape_pair);
-			area_enters.insert(p_shape_pair);
-		} else if (_has_shape_shifted(p_area, p_shape_pair.GetSubShapeID1()) || _has_shape_shifted(p_other_area, p_shape_pair.GetSubShapeID2())) {
-			// A shape has taken on the `JPH::SubShapeID` value of another shape, likely because of the other shape having been replaced or moved
-			// in some way, so we force the area to refresh its internal mappings by exiting and entering this shape pair.
-			area_exits.insert(p_shape_pair);
-			area_enters.insert(p_shape_pair);
-		}
+	if (!p_area.can_monitor(p_other_area)) {
+		_add_area_event(p_shape_pair, AREA_EVENT_NO_OVERLAP);
+	} else if (_has_shape_shifted(p_area, p_shape_pair.GetSubShapeID1()) || _has_shape_shifted(p_other_area, p_shape_pair.GetSubShapeID2())) {
+		_add_area_event(p_shape_pair, AREA_EVENT_OVERLAP_SHIFTED);
 	} else {
-		if (area_overlaps.erase(p_shape_pair)) {
-			area_exits.insert(p_shape_pair);
-		}
+		_add_area_event(p_shape_pair, AREA_EVENT_OVERLAP);
 	}
 }
 
 void JoltContactListener3D::_evaluate_area_overlap(const JoltArea3D &p_area, const JoltBody3D &p_body, const JPH::SubShapeIDPair &p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-
-	if (p_area.can_monitor(p_body)) {
-		if (!area_overlaps.has(p_shape_pair)) {
-			area_overlaps.insert(p_shape_pair);
-			area_enters.insert(p_shape_pair);
-		} else if (_has_shape_shifted(p_area, p_shape_pair.GetSubShapeID1()) || _has_shape_shifted(p_body, p_shape_pair.GetSubShapeID2())) {
-			// A shape has taken on the `JPH::SubShapeID` value of another shape, likely because of the other shape having been replaced or moved
-			// in some way, so we force the area to refresh its internal mappings by exiting and entering this shape pair.
-			area_exits.insert(p_shape_pair);
-			area_enters.insert(p_shape_pair);
-		}
+	if (!p_area.can_monitor(p_body)) {
+		_add_area_event(p_shape_pair, AREA_EVENT_NO_OVERLAP);
+	} else if (_has_shape_shifted(p_area, p_shape_pair.GetSubShapeID1()) || _has_shape_shifted(p_body, p_shape_pair.GetSubShapeID2())) {
+		_add_area_event(p_shape_pair, AREA_EVENT_OVERLAP_SHIFTED);
 	} else {
-		if (area_overlaps.erase(p_shape_pair)) {
-			area_exits.insert(p_shape_pair);
-		}
+		_add_area_event(p_shape_pair, AREA_EVENT_OVERLAP);
 	}
 }
 
 void JoltContactListener3D::_evaluate_area_overlap(const JoltArea3D &p_area, const JoltSoftBody3D &p_body, const JPH::SubShapeIDPair &p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-
 	if (p_area.can_monitor(p_body)) {
-		area_soft_body_overlaps.push_back(p_shape_pair);
-		if (!area_exits.erase(p_shape_pair)) {
-			area_enters.insert(p_shape_pair);
-		}
+		_add_area_event(p_shape_pair, AREA_EVENT_SOFT_BODY_OVERLAP);
 	}
 }
 
 void JoltContactListener3D::_flush_contacts() {
-	for (KeyValue<JPH::SubShapeIDPair, Manifold> &E : manifolds_by_shape_pair) {
-		const JPH::SubShapeIDPair &shape_pair = E.key;
-		Manifold &manifold = E.value;
+	if (ordered_manifold_count.load(std::memory_order_relaxed) > 0) {
+		for (const ThreadBuffer &buffer : thread_buffers) {
+			for (const Manifold &manifold : buffer.manifolds) {
+				if (manifold.order == 0) {
+					continue;
+				}
+
+				uint32_t *first_order = first_ordered_manifolds.getptr(manifold.shape_pair);
+
+				if (first_order == nullptr) {
+					first_ordered_manifolds.insert(manifold.shape_pair, manifold.order);
+				} else if (manifold.order < *first_order) {
+					*first_order = manifold.order;
+				}
+			}
+		}
+	}
 
-		JoltBody3D *body1 = space->try_get_body(shape_pair.GetBody1ID());
-		ERR_FAIL_NULL(body1);
+	previous_manifold_count = 0;
+	previous_contact_count = 0;
 
-		JoltBody3D *body2 = space->try_get_body(shape_pair.GetBody2ID());
-		ERR_FAIL_NULL(body2);
+	for (const ThreadBuffer &buffer : thread_buffers) {
+		previous_manifold_count += buffer.manifolds.size();
+		previous_contact_count += buffer.contacts.size();
 
-		const int shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
-		const int shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
+		for (const Manifold &manifold : buffer.manifolds) {
+			if (manifold.order != 0 && first_ordered_manifolds[manifold.shape_pair] != manifold.order) {
+				continue;
+			}
 
-		for (const Contact &contact : manifold.contacts1) {
-			body1->add_contact(body2, manifold.depth, shape_index1, shape_index2, contact.normal, contact.point_self, contact.point_other, contact.velocity_self, contact.velocity_other, contact.impulse);
-		}
+			const JPH::SubShapeIDPair &shape_pair = manifold.shape_pair;
+
+			JoltBody3D *body1 = space->try_get_body(shape_pair.GetBody1ID());
+			ERR_CONTINUE(body1 == nullptr);
+
+			JoltBody3D *body2 = space->try_get_body(shape_pair.GetBody2ID());
+			ERR_CONTINUE(body2 == nullptr);
+
+			const int shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
+			const int shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
+
+			const Contact *contacts = buffer.contacts.ptr() + manifold.contact_offset;
+
+			for (uint32_t i = 0; i < manifold.contact_count; i++) {
+				const Contact &contact = contacts[i * 2 + 0];
+				body1->add_contact(body2, manifold.depth, shape_index1, shape_index2, contact.normal, contact.point_self, contact.point_other, contact.velocity_self, contact.velocity_other, contact.impulse);
+			}
 
-		for (const Contact &contact : manifold.contacts2) {
-			body2->add_contact(body1, manifold.depth, shape_index2, shape_index1, contact.normal, contact.point_self, contact.point_other, contact.velocity_self, contact.velocity_other, contact.impulse);
+			for (uint32_t i = 0; i < manifold.contact_count; i++) {
+				const Contact &contact = contacts[i * 2 + 1];
+				body2->add_contact(body1, manifold.depth, shape_index2, shape_index1, contact.normal, contact.point_self, contact.point_other, contact.velocity_self, contact.velocity_other, contact.impulse);
+			}
 		}
+	}
+
+	first_ordered_manifolds.clear();
+}
 
-		manifold.contacts1.clear();
-		manifold.contacts2.clear();
+void JoltContactListener3D::_flush_area_events() {
+	for (const ThreadBuffer &buffer : thread_buffers) {
+		for (const AreaEvent &event : buffer.area_events) {
+			const JPH::SubShapeIDPair &shape_pair = event.shape_pair;
+
+			switch (event.type) {
+				case AREA_EVENT_OVERLAP: {
+					if (!area_overlaps.has(shape_pair)) {
+						area_overlaps.insert(shape_pair);
+						area_enters.insert(shape_pair);
+					}
+				} break;
+				case AREA_EVENT_OVERLAP_SHIFTED: {
+					if (!area_overlaps.has(shape_pair)) {
+						area_overlaps.insert(shape_pair);
+						area_enters.insert(shape_pair);
+					} else {
+						// A shape has taken on the `JPH::SubShapeID` value of another shape, likely because of the other shape having been replaced or moved
+						// in some way, so we force the area to refresh its internal mappings by exiting and entering this shape pair.
+						area_exits.insert(shape_pair);
+						area_enters.insert(shape_pair);
+					}
+				} break;
+				case AREA_EVENT_NO_OVERLAP: {
+					if (area_overlaps.erase(shape_pair)) {
+						area_exits.insert(shape_pair);
+					}
+				} break;
+				case AREA_EVENT_SOFT_BODY_OVERLAP: {
+					area_soft_body_overlaps.push_back(shape_pair);
+					if (!area_exits.erase(shape_pair)) {
+						area_enters.insert(shape_pair);
+					}
+				} break;
+				case AREA_EVENT_REMOVED: {
+					if (area_overlaps.is_empty()) {
+						break;
+					}
+
+					const JPH::SubShapeIDPair swapped_shape_pair(shape_pair.GetBody2ID(), shape_pair.GetSubShapeID2(), shape_pair.GetBody1ID(), shape_pair.GetSubShapeID1());
+
+					if (area_overlaps.erase(shape_pair)) {
+						area_exits.insert(shape_pair);
+					}
+
+					if (area_overlaps.erase(swapped_shape_pair)) {
+						area_exits.insert(swapped_shape_pair);
+					}
+				} break;
+			}
+		}
 	}
 }
 
@@ -552,9 +612,34 @@ void JoltContactListener3D::_clear_area_soft_body_overlaps() {
 	area_soft_body_overlaps.clear();
 }
 
+void JoltContactListener3D::_clear_thread_buffers() {
+	for (ThreadBuffer &buffer : thread_buffers) {
+		buffer.manifolds.clear();
+		buffer.contacts.clear();
+		buffer.area_events.clear();
+	}
+
+	ordered_manifold_count.store(0, std::memory_order_relaxed);
+}
+
 void JoltContactListener3D::pre_step() {
 	_clear_area_soft_body_overlaps();
 
+	// Pool threads can be added at runtime, so make sure every one of them has a buffer, and size them from the previous step to avoid growing them mid-step.
+	const uint32_t buffer_count = (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() + 1;
+
+	if (thread_buffers.size() < buffer_count) {
+		thread_buffers.resize(buffer_count);
+	}
+
+	const uint32_t expected_manifold_count = previous_manifold_count / buffer_count + 1;
+	const uint32_t expected_contact_count = previous_contact_count / buffer_count + 1;
+
+	for (ThreadBuffer &buffer : thread_buffers) {
+		buffer.manifolds.reserve(expected_manifold_count);
+		buffer.contacts.reserve(expected_contact_count);
+	}
+
 #ifdef DEBUG_ENABLED
 	debug_contact_count = 0;
 #endif
@@ -562,6 +647,8 @@ void JoltContactListener3D::pre_step() {
 
 void JoltContactListener3D::post_step() {
 	_flush_contacts();
+	_flush_area_events();
 	_flush_area_exits();
 	_flush_area_enters();
+	_clear_thread_buffers();
 }
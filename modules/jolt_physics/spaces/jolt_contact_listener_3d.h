@@ -75,20 +75,46 @@ class JoltContactListener3D final
 		Vector3 impulse;
 	};
 
-	typedef LocalVector<Contact> Contacts;
-
 	struct Manifold {
-		Contacts contacts1;
-		Contacts contacts2;
+		JPH::SubShapeIDPair shape_pair;
 		float depth = 0.0f;
+		uint32_t contact_offset = 0;
+		uint32_t contact_count = 0;
+
+		// Non-zero for manifolds involving a `JPH::EMotionQuality::LinearCast` body, which can be reported more than once per step.
+		uint32_t order = 0;
 	};
 
-	HashMap<JPH::SubShapeIDPair, Manifold, ShapePairHasher> manifolds_by_shape_pair;
+	enum AreaEventType : char {
+		AREA_EVENT_OVERLAP,
+		AREA_EVENT_OVERLAP_SHIFTED,
+		AREA_EVENT_NO_OVERLAP,
+		AREA_EVENT_SOFT_BODY_OVERLAP,
+		AREA_EVENT_REMOVED,
+	};
+
+	struct AreaEvent {
+		JPH::SubShapeIDPair shape_pair;
+		AreaEventType type = AREA_EVENT_OVERLAP;
+	};
+
+	// Only ever written to by one thread during the step, and merged in `post_step`.
+	struct ThreadBuffer {
+		LocalVector<Manifold> manifolds;
+		LocalVector<Contact> contacts;
+		LocalVector<AreaEvent> area_events;
+	};
+
+	LocalVector<ThreadBuffer> thread_buffers;
+	HashMap<JPH::SubShapeIDPair, uint32_t, ShapePairHasher> first_ordered_manifolds;
 	HashSet<JPH::SubShapeIDPair, ShapePairHasher> area_overlaps;
 	HashSet<JPH::SubShapeIDPair, ShapePairHasher> area_enters;
 	HashSet<JPH::SubShapeIDPair, ShapePairHasher> area_exits;
 	LocalVector<JPH::SubShapeIDPair> area_soft_body_overlaps;
-	Mutex write_mutex;
+	Mutex shared_buffer_mutex;
+	std::atomic_uint32_t ordered_manifold_count = 0;
+	uint32_t previous_manifold_count = 0;
+	uint32_t previous_contact_count = 0;
 	JoltSpace3D *space = nullptr;
 
 #ifdef DEBUG_ENABLED
@@ -108,8 +134,7 @@ class JoltContactListener3D final
 	bool _try_apply_surface_velocities(const JPH::Body &p_jolt_body1, const JPH::Body &p_jolt_body2, JPH::ContactSettings &p_settings);
 	bool _try_add_contacts(const JPH::Body &p_jolt_body1, const JPH::Body &p_jolt_body2, const JPH::ContactManifold &p_manifold, JPH::ContactSettings &p_settings);
 	bool _try_evaluate_area_overlap(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::SubShapeID &p_shape_id1, const JPH::SubShapeID &p_shape_id2);
-	bool _try_remove_contacts(const JPH::SubShapeIDPair &p_shape_pair);
-	bool _try_remove_area_overlap(const JPH::SubShapeIDPair &p_shape_pair);
+	void _add_area_event(const JPH::SubShapeIDPair &p_shape_pair, AreaEventType p_type);
 
 #ifdef DEBUG_ENABLED
 	bool _try_add_debug_contacts(const JPH::Body &p_body1, const JPH::Body &p_body2, const JPH::ContactManifold &p_manifold);
@@ -122,10 +147,15 @@ class JoltContactListener3D final
 	void _evaluate_area_overlap(const JoltArea3D &p_area, const JoltBody3D &p_body, const JPH::SubShapeIDPair &p_shape_pair);
 	void _evaluate_area_overlap(const JoltArea3D &p_area, const JoltSoftBody3D &p_body, const JPH::SubShapeIDPair &p_shape_pair);
 
+	template <typename F>
+	void _write_thread_buffer(F p_write);
+
 	void _flush_contacts();
+	void _flush_area_events();
 	void _flush_area_enters();
 	void _flush_area_exits();
 	void _clear_area_soft_body_overlaps();
+	void _clear_thread_buffers();
 
 public:
 	explicit JoltContactListener3D(JoltSpace3D *p_space) :
@@ -790,6 +790,23 @@ bool JoltPhysicsDirectSpaceState3D::rest_info(const PS3DT::ShapeParameters &p_pa
 	return true;
 }
 
+void JoltPhysicsDirectSpaceState3D::intersect_rays_batch(const PS3DT::RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, const uint32_t *p_collision_masks, int p_count, PS3DT::RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_rays_batch must not be called while the physics space is being stepped.");
+
+	// Flushed once up front, so the individual queries only read the space when running on worker threads.
+	space->flush_pending_objects();
+
+	PhysicsDirectSpaceState3D::intersect_rays_batch(p_parameters, p_from, p_to, p_collision_masks, p_count, r_results, r_hits);
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_shapes_batch(const PS3DT::ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, PS3DT::ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_shapes_batch must not be called while the physics space is being stepped.");
+
+	space->flush_pending_objects();
+
+	PhysicsDirectSpaceState3D::intersect_shapes_batch(p_parameters, p_transforms, p_count, r_results, p_result_max, r_result_counts);
+}
+
 Vector3 JoltPhysicsDirectSpaceState3D::get_closest_point_to_object_volume(RID p_object, Vector3 p_point) const {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), Vector3(), "get_closest_point_to_object_volume must not be called while the physics space is being stepped.");
 
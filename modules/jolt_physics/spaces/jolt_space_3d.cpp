@@ -34,6 +34,7 @@
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
 #include "../misc/jolt_stream_wrappers.h"
+#include "../misc/jolt_type_conversions.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
 #include "../shapes/jolt_shape_3d.h"
@@ -50,6 +51,7 @@
 #include <Jolt/Physics/Collision/CollideShapeVsShapePerLeaf.h>
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
 #include <Jolt/Physics/PhysicsScene.h>
+#include <Jolt/Physics/StateRecorderImpl.h>
 
 namespace {
 
@@ -552,6 +554,70 @@ void JoltSpace3D::remove_joint(JoltJoint3D *p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+Vector<uint8_t> JoltSpace3D::save_state() {
+	ERR_FAIL_COND_V_MSG(stepping, Vector<uint8_t>(), "Space state can't be saved while the space is being stepped.");
+
+	flush_pending_objects();
+
+	// This includes the contact cache, so that warm starting carries over when the state is restored.
+	JPH::StateRecorderImpl recorder;
+	physics_system->SaveState(recorder);
+
+	const std::string data = recorder.GetData();
+
+	Vector<uint8_t> state;
+	state.resize((int64_t)data.size());
+	memcpy(state.ptrw(), data.data(), data.size());
+
+	return state;
+}
+
+bool JoltSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(stepping, false, "Space state can't be restored while the space is being stepped.");
+	ERR_FAIL_COND_V_MSG(p_state.is_empty(), false, "Invalid space state.");
+
+	flush_pending_objects();
+
+	JPH::StateRecorderImpl recorder;
+	recorder.WriteBytes(p_state.ptr(), (size_t)p_state.size());
+	recorder.Rewind();
+
+	ERR_FAIL_COND_V_MSG(!physics_system->RestoreState(recorder), false, "Failed to restore space state. The bodies in the space must be the same as when the state was saved.");
+
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	for (const JPH::BodyID &body_id : body_ids) {
+		JoltBody3D *body = try_get_body(body_id);
+		if (body != nullptr) {
+			body->state_restored();
+		}
+	}
+
+	return true;
+}
+
+void JoltSpace3D::shift_origin(const Vector3 &p_offset) {
+	ERR_FAIL_COND_MSG(stepping, "Space origin can't be shifted while the space is being stepped.");
+
+	flush_pending_objects();
+
+	JPH::BodyInterface &body_iface = get_body_iface();
+	const JPH::RVec3 offset = to_jolt_r(p_offset);
+
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	for (const JPH::BodyID &body_id : body_ids) {
+		body_iface.SetPosition(body_id, body_iface.GetPosition(body_id) - offset, JPH::EActivation::DontActivate);
+
+		JoltBody3D *body = try_get_body(body_id);
+		if (body != nullptr) {
+			body->origin_shifted(p_offset);
+		}
+	}
+}
+
 #ifdef DEBUG_ENABLED
 
 void JoltSpace3D::dump_debug_snapshot(const String &p_dir) {
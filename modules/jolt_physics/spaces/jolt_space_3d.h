@@ -164,6 +164,11 @@ public:
 	void remove_joint(JPH::Constraint *p_jolt_ref);
 	void remove_joint(JoltJoint3D *p_joint);
 
+	Vector<uint8_t> save_state();
+	bool restore_state(const Vector<uint8_t> &p_state);
+
+	void shift_origin(const Vector3 &p_offset);
+
 #ifdef DEBUG_ENABLED
 	void dump_debug_snapshot(const String &p_dir);
 	const PackedVector3Array &get_debug_contacts() const;
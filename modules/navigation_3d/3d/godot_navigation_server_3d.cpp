@@ -32,7 +32,10 @@
 
 #include "nav_mesh_generator_3d.h"
 
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
+#include "core/os/os.h"
 #include "scene/main/node.h"
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 
@@ -288,6 +291,13 @@ RID GodotNavigationServer3D::map_get_closest_point_owner(RID p_map, const Vector
 	return map->get_closest_point_owner(p_point);
 }
 
+Vector3 GodotNavigationServer3D::map_get_flow_direction(RID p_map, const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector3());
+
+	return map->get_flow_direction(p_position, p_target_position, p_navigation_layers);
+}
+
 TypedArray<RID> GodotNavigationServer3D::map_get_links(RID p_map) const {
 	TypedArray<RID> link_rids;
 	const NavMap3D *map = map_owner.get_or_null(p_map);
@@ -382,6 +392,27 @@ Vector3 GodotNavigationServer3D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+COMMAND_2(map_set_connection_data, RID, p_map, Vector<uint8_t>, p_data) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_connection_data(p_data);
+}
+
+Vector<uint8_t> GodotNavigationServer3D::map_get_connection_data(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Vector<uint8_t>());
+
+	return map->get_connection_data();
+}
+
+int64_t GodotNavigationServer3D::map_get_memory_usage(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_memory_usage();
+}
+
 RID GodotNavigationServer3D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -1379,6 +1410,8 @@ void GodotNavigationServer3D::process(double p_delta_time) {
 	// E.g. (final) sync of objects for this main loop iteration, updating rendered debug visuals, updating debug statistics, ...
 
 	sync();
+
+	_process_async_path_queries();
 }
 
 void GodotNavigationServer3D::physics_process(double p_delta_time) {
@@ -1404,6 +1437,10 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	uint64_t _new_pm_map_build_time = 0;
+	int _new_pm_path_corridor_cache_hit_count = 0;
+	int _new_pm_path_corridor_cache_miss_count = 0;
+	int _new_pm_connection_data_load_count = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
@@ -1420,6 +1457,10 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_map_build_time += active_maps[i]->get_pm_iteration_build_time();
+		_new_pm_path_corridor_cache_hit_count += active_maps[i]->get_pm_path_corridor_cache_hit_count();
+		_new_pm_path_corridor_cache_miss_count += active_maps[i]->get_pm_path_corridor_cache_miss_count();
+		_new_pm_connection_data_load_count += active_maps[i]->get_pm_connection_data_loaded() ? 1 : 0;
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1431,16 +1472,35 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_map_build_time = _new_pm_map_build_time;
+	pm_path_corridor_cache_hit_count = _new_pm_path_corridor_cache_hit_count;
+	pm_path_corridor_cache_miss_count = _new_pm_path_corridor_cache_miss_count;
+	pm_connection_data_load_count = _new_pm_connection_data_load_count;
 }
 
 void GodotNavigationServer3D::init() {
 	navmesh_generator_3d = memnew(NavMeshGenerator3D);
 	RWLockRead read_lock(geometry_parser_rwlock);
 	navmesh_generator_3d->set_generator_parsers(generator_parsers);
+
+	// Run no more async path queries at once than a map has path query slots, extra tasks would only block on them.
+	const int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	async_path_query_tasks_max = GLOBAL_GET("navigation/pathfinding/max_threads");
+	if (async_path_query_tasks_max < 0 || async_path_query_tasks_max > thread_count) {
+		async_path_query_tasks_max = thread_count;
+	}
+	if (async_path_query_tasks_max < 1) {
+		async_path_query_tasks_max = 1;
+	}
 }
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+	{
+		MutexLock lock(async_path_queries_mutex);
+		async_path_queries.clear();
+		async_path_queries_head = 0;
+	}
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
 		memdelete(navmesh_generator_3d);
@@ -1458,6 +1518,78 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+	ERR_FAIL_NULL(map_owner.get_or_null(p_query_parameters->get_map()));
+
+	AsyncPathQuery query;
+	query.parameters = p_query_parameters;
+	query.result = p_query_result;
+	query.callback = p_callback;
+
+	MutexLock lock(async_path_queries_mutex);
+	async_path_queries.push_back(query);
+}
+
+void GodotNavigationServer3D::_process_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries) {
+	AsyncPathQuery &query = p_queries[p_index];
+	if (query.map == nullptr) {
+		return;
+	}
+
+	// Callbacks are emitted afterwards on the main thread.
+	NavMeshQueries3D::map_query_path(query.map, query.parameters, query.result, Callable());
+}
+
+void GodotNavigationServer3D::_process_async_path_queries() {
+	const uint64_t time_budget_usec = GLOBAL_GET_CACHED(double, "navigation/pathfinding/async_query_time_budget_msec") * 1000.0;
+	const uint64_t start_usec = OS::get_singleton()->get_ticks_usec();
+	const uint32_t batch_size_max = async_path_query_tasks_max * 4;
+
+	// Always process at least one batch so the queue keeps moving even with a tiny budget.
+	do {
+		{
+			MutexLock lock(async_path_queries_mutex);
+			const uint32_t pending_count = async_path_queries.size() - async_path_queries_head;
+			if (pending_count == 0) {
+				break;
+			}
+
+			const uint32_t batch_size = MIN(pending_count, batch_size_max);
+			async_path_query_batch.resize(batch_size);
+			for (uint32_t i = 0; i < batch_size; i++) {
+				async_path_query_batch[i] = async_path_queries[async_path_queries_head + i];
+			}
+			async_path_queries_head += batch_size;
+
+			if (async_path_queries_head == async_path_queries.size()) {
+				async_path_queries.clear();
+				async_path_queries_head = 0;
+			}
+		}
+
+		for (AsyncPathQuery &query : async_path_query_batch) {
+			// The map may have been freed since the query was submitted.
+			query.map = map_owner.get_or_null(query.parameters->get_map());
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_process_async_path_query, async_path_query_batch.ptr(), async_path_query_batch.size(), async_path_query_tasks_max, true, SNAME("NavigationServer3DAsyncPathQueries"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (const AsyncPathQuery &query : async_path_query_batch) {
+			if (!query.map) {
+				// Report an empty path rather than leaving the caller waiting for a query that can't run.
+				query.result->reset();
+			}
+			if (query.callback.is_valid()) {
+				NavMeshQueries3D::emit_callback(query.callback);
+			}
+		}
+		async_path_query_batch.clear();
+	} while (OS::get_singleton()->get_ticks_usec() - start_usec < time_budget_usec);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1545,6 +1677,22 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_PATH_QUERY_PENDING_COUNT: {
+			MutexLock lock(async_path_queries_mutex);
+			return async_path_queries.size() - async_path_queries_head;
+		} break;
+		case INFO_MAP_BUILD_TIME: {
+			return pm_map_build_time;
+		} break;
+		case INFO_PATH_CORRIDOR_CACHE_HIT_COUNT: {
+			return pm_path_corridor_cache_hit_count;
+		} break;
+		case INFO_PATH_CORRIDOR_CACHE_MISS_COUNT: {
+			return pm_path_corridor_cache_miss_count;
+		} break;
+		case INFO_CONNECTION_DATA_LOAD_COUNT: {
+			return pm_connection_data_load_count;
+		} break;
 	}
 
 	return 0;
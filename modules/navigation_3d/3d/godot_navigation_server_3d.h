@@ -82,6 +82,23 @@ class GodotNavigationServer3D : public NavigationServer3D {
 
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 
+	struct AsyncPathQuery {
+		Ref<NavigationPathQueryParameters3D> parameters;
+		Ref<NavigationPathQueryResult3D> result;
+		Callable callback;
+		NavMap3D *map = nullptr;
+	};
+
+	/// Path queries submitted with `query_path_async`, processed in batches during `process`.
+	Mutex async_path_queries_mutex;
+	LocalVector<AsyncPathQuery> async_path_queries;
+	uint32_t async_path_queries_head = 0;
+	LocalVector<AsyncPathQuery> async_path_query_batch;
+	int async_path_query_tasks_max = 1;
+
+	void _process_async_path_queries();
+	void _process_async_path_query(uint32_t p_index, AsyncPathQuery *p_queries);
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -92,6 +109,10 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	uint64_t pm_map_build_time = 0;
+	int pm_path_corridor_cache_hit_count = 0;
+	int pm_path_corridor_cache_miss_count = 0;
+	int pm_connection_data_load_count = 0;
 
 public:
 	GodotNavigationServer3D();
@@ -132,6 +153,7 @@ public:
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const override;
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const override;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector3 &p_point) const override;
+	virtual Vector3 map_get_flow_direction(RID p_map, const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers = 1) const override;
 
 	virtual TypedArray<RID> map_get_links(RID p_map) const override;
 	virtual TypedArray<RID> map_get_regions(RID p_map) const override;
@@ -146,6 +168,11 @@ public:
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
 
+	COMMAND_2(map_set_connection_data, RID, p_map, Vector<uint8_t>, p_data);
+	virtual Vector<uint8_t> map_get_connection_data(RID p_map) const override;
+
+	virtual int64_t map_get_memory_usage(RID p_map) const override;
+
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
 
@@ -293,6 +320,7 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_avoidance_grid_3d.h"
+
+#include "core/math/math_funcs_binary.h"
+
+void NavAvoidanceGrid3D::_write_slot(uint32_t p_slot, uint32_t p_agent_index) {
+	const Agent &agent = agents[p_agent_index];
+	slot_cells[p_slot] = agent_cells[p_agent_index];
+	slot_agents[p_slot] = p_agent_index;
+	slot_positions_x[p_slot] = agent.position.x;
+	slot_positions_y[p_slot] = agent.position.y;
+	slot_positions_z[p_slot] = agent.position.z;
+	slot_heights[p_slot] = agent.height;
+	slot_avoidance_layers[p_slot] = agent.avoidance_layers;
+	slot_avoidance_priorities[p_slot] = agent.avoidance_priority;
+}
+
+void NavAvoidanceGrid3D::update(const LocalVector<Agent> &p_agents) {
+	const uint32_t agent_count = p_agents.size();
+
+	// One cell per largest neighbor distance so a query never needs more than two cells per axis.
+	real_t max_neighbor_distance = 0.0;
+	for (const Agent &agent : p_agents) {
+		if (agent.max_neighbors > 0) {
+			max_neighbor_distance = MAX(max_neighbor_distance, agent.neighbor_distance);
+		}
+	}
+	const float new_cell_size = max_neighbor_distance > 0.0 ? (float)max_neighbor_distance : 1.0f;
+
+	bool rebuild = agent_count != agents.size() || new_cell_size != cell_size;
+
+	agents = p_agents;
+	cell_size = new_cell_size;
+	inv_cell_size = 1.0f / cell_size;
+
+	if (agent_cells.size() != agent_count) {
+		agent_cells.resize(agent_count);
+		agent_slots.resize(agent_count);
+	}
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const Vector3i cell = _get_cell(agents[i].position);
+		if (cell != agent_cells[i]) {
+			agent_cells[i] = cell;
+			rebuild = true;
+		}
+	}
+
+	if (!rebuild) {
+		// Every agent stayed in its cell, the sorted order is still valid.
+		for (uint32_t i = 0; i < agent_count; i++) {
+			_write_slot(agent_slots[i], i);
+		}
+		return;
+	}
+
+	const uint32_t bucket_count = Math::next_power_of_2(MAX(agent_count * 2, 16u));
+	bucket_mask = bucket_count - 1;
+
+	bucket_offsets.resize(bucket_count + 1);
+	memset(bucket_offsets.ptr(), 0, bucket_offsets.size() * sizeof(uint32_t));
+	for (uint32_t i = 0; i < agent_count; i++) {
+		bucket_offsets[_get_bucket(agent_cells[i]) + 1]++;
+	}
+	for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+		bucket_offsets[bucket + 1] += bucket_offsets[bucket];
+	}
+
+	slot_cells.resize(agent_count);
+	slot_agents.resize(agent_count);
+	slot_positions_x.resize(agent_count);
+	slot_positions_y.resize(agent_count);
+	slot_positions_z.resize(agent_count);
+	slot_heights.resize(agent_count);
+	slot_avoidance_layers.resize(agent_count);
+	slot_avoidance_priorities.resize(agent_count);
+
+	LocalVector<uint32_t> bucket_cursors;
+	bucket_cursors.resize(bucket_count);
+	memcpy(bucket_cursors.ptr(), bucket_offsets.ptr(), bucket_count * sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const uint32_t slot = bucket_cursors[_get_bucket(agent_cells[i])]++;
+		agent_slots[i] = slot;
+		_write_slot(slot, i);
+	}
+}
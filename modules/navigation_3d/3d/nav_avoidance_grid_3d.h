@@ -0,0 +1,181 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/templates/local_vector.h"
+
+#include <vector>
+
+// Uniform grid used for the avoidance agent neighbor search instead of the RVO agent kd-tree.
+// Agents are kept sorted by cell in a structure of arrays. As long as no agent changes its cell
+// between two updates the sorted order is kept and only the agent data is refreshed in place.
+// In 2D mode the grid spans the XZ plane and the Y position is used as the agent elevation.
+class NavAvoidanceGrid3D {
+public:
+	struct Agent {
+		Vector3 position;
+		real_t height = 0.0;
+		real_t neighbor_distance = 0.0;
+		uint32_t max_neighbors = 0;
+		uint32_t avoidance_layers = 1;
+		uint32_t avoidance_mask = 1;
+		real_t avoidance_priority = 1.0;
+	};
+
+private:
+	bool use_3d = false;
+	float cell_size = 0.0;
+	float inv_cell_size = 0.0;
+	uint32_t bucket_mask = 0;
+
+	LocalVector<Agent> agents;
+	LocalVector<Vector3i> agent_cells;
+	LocalVector<uint32_t> agent_slots;
+
+	// Agents sorted by bucket, bucket_offsets[b] to bucket_offsets[b + 1] are the slots of bucket b.
+	LocalVector<uint32_t> bucket_offsets;
+	LocalVector<Vector3i> slot_cells;
+	LocalVector<uint32_t> slot_agents;
+	LocalVector<float> slot_positions_x;
+	LocalVector<float> slot_positions_y;
+	LocalVector<float> slot_positions_z;
+	LocalVector<float> slot_heights;
+	LocalVector<uint32_t> slot_avoidance_layers;
+	LocalVector<float> slot_avoidance_priorities;
+
+	_FORCE_INLINE_ Vector3i _get_cell(const Vector3 &p_position) const {
+		return Vector3i(
+				(int)Math::floor(p_position.x * inv_cell_size),
+				use_3d ? (int)Math::floor(p_position.y * inv_cell_size) : 0,
+				(int)Math::floor(p_position.z * inv_cell_size));
+	}
+
+	_FORCE_INLINE_ uint32_t _get_bucket(const Vector3i &p_cell) const {
+		return ((uint32_t)p_cell.x * 73856093u ^ (uint32_t)p_cell.y * 19349663u ^ (uint32_t)p_cell.z * 83492791u) & bucket_mask;
+	}
+
+	void _write_slot(uint32_t p_slot, uint32_t p_agent_index);
+
+public:
+	void update(const LocalVector<Agent> &p_agents);
+
+	uint32_t get_agent_count() const { return agents.size(); }
+
+	// Collects the closest neighbors of an agent sorted by squared distance, the same way the RVO kd-tree does.
+	// The neighbor entries point into p_agents which has to be in the same order as the agents of the last update.
+	template <typename T>
+	void get_agent_neighbors(uint32_t p_agent_index, T *const *p_agents, std::vector<std::pair<float, const T *>> &r_neighbors) const {
+		r_neighbors.clear();
+
+		const Agent &agent = agents[p_agent_index];
+		if (agent.max_neighbors == 0) {
+			return;
+		}
+
+		const float position_x = agent.position.x;
+		const float position_y = agent.position.y;
+		const float position_z = agent.position.z;
+		const float elevation_begin = position_y;
+		const float elevation_end = position_y + (float)agent.height;
+		const uint32_t avoidance_mask = agent.avoidance_mask;
+		const float avoidance_priority = agent.avoidance_priority;
+		const size_t max_neighbors = agent.max_neighbors;
+
+		float range_sq = (float)agent.neighbor_distance * (float)agent.neighbor_distance;
+
+		const Vector3 range = Vector3(agent.neighbor_distance, agent.neighbor_distance, agent.neighbor_distance);
+		const Vector3i cell_begin = _get_cell(agent.position - range);
+		const Vector3i cell_end = _get_cell(agent.position + range);
+
+		Vector3i cell;
+		for (cell.x = cell_begin.x; cell.x <= cell_end.x; cell.x++) {
+			for (cell.y = cell_begin.y; cell.y <= cell_end.y; cell.y++) {
+				for (cell.z = cell_begin.z; cell.z <= cell_end.z; cell.z++) {
+					const uint32_t bucket = _get_bucket(cell);
+					const uint32_t slot_end = bucket_offsets[bucket + 1];
+
+					for (uint32_t slot = bucket_offsets[bucket]; slot < slot_end; slot++) {
+						const float dx = position_x - slot_positions_x[slot];
+						const float dz = position_z - slot_positions_z[slot];
+						float dist_sq;
+						if (use_3d) {
+							const float dy = position_y - slot_positions_y[slot];
+							dist_sq = dx * dx + dy * dy + dz * dz;
+						} else {
+							dist_sq = dx * dx + dz * dz;
+						}
+						if (dist_sq >= range_sq) {
+							continue;
+						}
+						// Different cells can share a bucket.
+						if (slot_cells[slot] != cell) {
+							continue;
+						}
+						const uint32_t other_agent_index = slot_agents[slot];
+						if (other_agent_index == p_agent_index) {
+							continue;
+						}
+						if ((avoidance_mask & slot_avoidance_layers[slot]) == 0) {
+							continue;
+						}
+						// Ignore other agent if this agent is below or above.
+						if (!use_3d && (elevation_begin > slot_positions_y[slot] + slot_heights[slot] || elevation_end < slot_positions_y[slot])) {
+							continue;
+						}
+						if (avoidance_priority > slot_avoidance_priorities[slot]) {
+							continue;
+						}
+
+						if (r_neighbors.size() < max_neighbors) {
+							r_neighbors.push_back(std::make_pair(dist_sq, (const T *)p_agents[other_agent_index]));
+						}
+
+						size_t i = r_neighbors.size() - 1;
+						while (i != 0 && dist_sq < r_neighbors[i - 1].first) {
+							r_neighbors[i] = r_neighbors[i - 1];
+							--i;
+						}
+						r_neighbors[i] = std::make_pair(dist_sq, (const T *)p_agents[other_agent_index]);
+
+						if (r_neighbors.size() == max_neighbors) {
+							range_sq = r_neighbors.back().first;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	NavAvoidanceGrid3D(bool p_use_3d = false) :
+			use_3d(p_use_3d) {}
+};
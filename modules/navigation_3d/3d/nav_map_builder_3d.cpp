@@ -35,9 +35,41 @@
 #include "nav_region_iteration_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 
 using namespace Nav3D;
 
+// Below these amounts of work the build steps run on the calling thread, as spawning tasks would cost more than it saves.
+static constexpr uint32_t EDGE_SHARD_PARALLEL_EDGE_COUNT = 4096;
+static constexpr uint64_t REGION_PAIR_PARALLEL_EDGE_TESTS = 16384;
+
+#ifdef TESTS_ENABLED
+SafeNumeric<uint64_t> NavMapBuilder3D::built_region_pair_count;
+#endif // TESTS_ENABLED
+
+struct NavMapBuilderTask3D {
+	NavMapIterationBuild3D *build = nullptr;
+	uint32_t index = 0;
+	uint32_t count = 0;
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+};
+
+// Stored map connection data starts with this header, followed by a checksum of the rest of the data and the connection data hash of the map iteration.
+static constexpr uint8_t CONNECTION_DATA_MAGIC[4] = { 'N', 'M', 'C', '3' };
+static constexpr uint32_t CONNECTION_DATA_VERSION = 1;
+static constexpr uint32_t CONNECTION_DATA_CHECKSUM_OFFSET = 8;
+
+struct FreeEdgeSort {
+	_FORCE_INLINE_ bool operator()(const Connection &p_left, const Connection &p_right) const {
+		if (p_left.polygon->id != p_right.polygon->id) {
+			return p_left.polygon->id < p_right.polygon->id;
+		}
+		return p_left.edge < p_right.edge;
+	}
+};
+
 PointKey NavMapBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
 	const int x = static_cast<int>(Math::floor(p_pos.x / p_cell_size.x));
 	const int y = static_cast<int>(Math::floor(p_pos.y / p_cell_size.y));
@@ -60,19 +92,37 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 	performance_data.pm_edge_connection_count = 0;
 	performance_data.pm_edge_free_count = 0;
 
+	const uint64_t build_start_usec = OS::get_singleton()->get_ticks_usec();
+	r_build.build_pass++;
+
 	_build_step_gather_region_polygons(r_build);
 
-	_build_step_find_edge_connection_pairs(r_build);
+	r_build.map_iteration->connection_data_hash = _get_connection_data_hash(r_build);
 
-	_build_step_merge_edge_connection_pairs(r_build);
+	if (!_build_step_load_connection_data(r_build)) {
+		_build_step_find_edge_connection_pairs(r_build);
 
-	_build_step_edge_connection_margin_connections(r_build);
+		_build_step_merge_edge_connection_pairs(r_build);
 
-	_build_step_navlink_connections(r_build);
+		_build_step_edge_connection_margin_connections(r_build);
+
+		_build_step_navlink_connections(r_build);
+	}
+
+	_build_step_navbase_clusters(r_build);
 
 	_build_update_map_iteration(r_build);
+
+	performance_data.pm_iteration_build_time = OS::get_singleton()->get_ticks_usec() - build_start_usec;
 }
 
+#ifdef TESTS_ENABLED
+uint64_t NavMapBuilder3D::get_built_region_pair_count() {
+	// Region pairs reused from a previous build are not counted.
+	return built_region_pair_count.get();
+}
+#endif // TESTS_ENABLED
+
 void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
@@ -85,12 +135,19 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D
 	// Remove regions connections.
 	region_external_connections.clear();
 
+	r_build.iter_region_free_edges.resize(regions.size());
+	r_build.iter_region_free_edges_hashes.resize(regions.size());
+	r_build.iter_region_indices.reserve(regions.size());
+
 	// Copy all region polygons in the map.
 	int polygon_count = 0;
-	for (const Ref<NavRegionIteration3D> &region : regions) {
+	for (uint32_t region_index = 0; region_index < regions.size(); region_index++) {
+		const Ref<NavRegionIteration3D> &region = regions[region_index];
 		const uint32_t polygons_size = region->navmesh_polygons.size();
 		polygon_count += polygons_size;
 
+		r_build.iter_region_indices.insert(region.ptr(), region_index);
+
 		region_external_connections[region.ptr()] = LocalVector<Connection>();
 		map_iteration->navbases_polygons_external_connections[region.ptr()] = LocalVector<LocalVector<Connection>>();
 		map_iteration->navbases_polygons_external_connections[region.ptr()].resize(polygons_size);
@@ -100,28 +157,23 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D
 	r_build.polygon_count = polygon_count;
 }
 
-void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
+void NavMapBuilder3D::_build_edge_shard(NavMapIterationBuild3D &r_build, uint32_t p_shard_index) {
+	NavMapIterationBuild3D::EdgeShard &shard = r_build.iter_edge_shards[p_shard_index];
+	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = shard.connection_pairs_map;
 
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
-
-	// Group all edges per key.
-	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
-	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
-	int edge_merge_error_count = 0;
-
-	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+	// Every shard walks the regions in the same order, so each key sees its edges in the same order as with a single map.
+	for (const Ref<NavRegionIteration3D> &region : r_build.map_iteration->region_iterations) {
 		for (const ConnectableEdge &connectable_edge : region->get_external_edges()) {
 			const EdgeKey &ek = connectable_edge.ek;
+			if (EdgeKey::hash(ek) % NavMapIterationBuild3D::EDGE_SHARD_COUNT != p_shard_index) {
+				continue;
+			}
 
 			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
 			if (!pair_it) {
 				pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-				performance_data.pm_edge_count += 1;
-				++free_edges_count;
+				shard.edge_count += 1;
+				++shard.free_edge_count;
 			}
 			EdgeConnectionPair &pair = pair_it->value;
 			if (pair.size < 2) {
@@ -135,15 +187,64 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 				pair.connections[pair.size] = new_connection;
 				++pair.size;
 				if (pair.size == 2) {
-					--free_edges_count;
+					--shard.free_edge_count;
 				}
 
 			} else {
 				// The edge is already connected with another edge, skip.
-				edge_merge_error_count++;
+				shard.edge_merge_error_count++;
 			}
 		}
 	}
+}
+
+void NavMapBuilder3D::_build_edge_shard_task(void *p_arg) {
+	NavMapBuilderTask3D *task = static_cast<NavMapBuilderTask3D *>(p_arg);
+	_build_edge_shard(*task->build, task->index);
+}
+
+void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
+	PerformanceData &performance_data = r_build.performance_data;
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	int polygon_count = r_build.polygon_count;
+
+	uint32_t external_edge_count = 0;
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		external_edge_count += region->get_external_edges().size();
+	}
+
+	// Group all edges per key.
+	for (NavMapIterationBuild3D::EdgeShard &shard : r_build.iter_edge_shards) {
+		shard.connection_pairs_map.clear();
+		shard.connection_pairs_map.reserve(polygon_count / NavMapIterationBuild3D::EDGE_SHARD_COUNT + 1);
+		shard.edge_count = 0;
+		shard.free_edge_count = 0; // How many ConnectionPairs have only one Connection.
+		shard.edge_merge_error_count = 0;
+	}
+
+	if (external_edge_count >= EDGE_SHARD_PARALLEL_EDGE_COUNT) {
+		NavMapBuilderTask3D tasks[NavMapIterationBuild3D::EDGE_SHARD_COUNT];
+		for (uint32_t i = 0; i < NavMapIterationBuild3D::EDGE_SHARD_COUNT; i++) {
+			tasks[i].build = &r_build;
+			tasks[i].index = i;
+			tasks[i].task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMapBuilder3D::_build_edge_shard_task, &tasks[i], true, SNAME("NavMapBuilder3DEdges"));
+		}
+		for (const NavMapBuilderTask3D &task : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task.task_id);
+		}
+	} else {
+		for (uint32_t i = 0; i < NavMapIterationBuild3D::EDGE_SHARD_COUNT; i++) {
+			_build_edge_shard(r_build, i);
+		}
+	}
+
+	int free_edges_count = 0;
+	int edge_merge_error_count = 0;
+	for (const NavMapIterationBuild3D::EdgeShard &shard : r_build.iter_edge_shards) {
+		performance_data.pm_edge_count += shard.edge_count;
+		free_edges_count += shard.free_edge_count;
+		edge_merge_error_count += shard.edge_merge_error_count;
+	}
 
 	if (edge_merge_error_count > 0 && GLOBAL_GET_CACHED(bool, "navigation/3d/warnings/navmesh_edge_merge_errors")) {
 		WARN_PRINT("Navigation map synchronization had " + itos(edge_merge_error_count) + " edge error(s).\nMore than 2 edges tried to occupy the same map rasterization space.\nThis causes a logical error in the navigation mesh geometry and is commonly caused by overlap or too densely placed edges.\nConsider baking with a higher 'cell_size', greater geometry margin, and less detailed bake objects to cause fewer edges.\nConsider lowering the 'navigation/3d/merge_rasterizer_cell_scale' in the project settings.\nThis warning can be toggled under 'navigation/3d/warnings/navmesh_edge_merge_errors' in the project settings.");
@@ -154,72 +255,63 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 
 void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
-
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
-	LocalVector<Connection> &free_edges = r_build.iter_free_edges;
-	int free_edges_count = r_build.free_edge_count;
 	bool use_edge_connections = r_build.use_edge_connections;
 
-	free_edges.clear();
-	free_edges.reserve(free_edges_count);
-
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
 	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
 
-	for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : connection_pairs_map) {
-		const EdgeConnectionPair &pair = pair_it.value;
-		if (pair.size == 2) {
-			// Connect edge that are shared in different polygons.
-			const Connection &c1 = pair.connections[0];
-			const Connection &c2 = pair.connections[1];
+	for (const NavMapIterationBuild3D::EdgeShard &shard : r_build.iter_edge_shards) {
+		for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : shard.connection_pairs_map) {
+			const EdgeConnectionPair &pair = pair_it.value;
+			if (pair.size == 2) {
+				// Connect edge that are shared in different polygons.
+				const Connection &c1 = pair.connections[0];
+				const Connection &c2 = pair.connections[1];
 
-			navbases_polygons_external_connections[c1.polygon->owner][c1.polygon->id].push_back(c2);
-			navbases_polygons_external_connections[c2.polygon->owner][c2.polygon->id].push_back(c1);
-			performance_data.pm_edge_connection_count += 1;
+				navbases_polygons_external_connections[c1.polygon->owner][c1.polygon->id].push_back(c2);
+				navbases_polygons_external_connections[c2.polygon->owner][c2.polygon->id].push_back(c1);
+				performance_data.pm_edge_connection_count += 1;
 
-		} else {
-			CRASH_COND_MSG(pair.size != 1, vformat("Number of connection != 1. Found: %d", pair.size));
-			if (use_edge_connections && pair.connections[0].polygon->owner->get_use_edge_connections()) {
-				free_edges.push_back(pair.connections[0]);
+			} else {
+				CRASH_COND_MSG(pair.size != 1, vformat("Number of connection != 1. Found: %d", pair.size));
+				if (use_edge_connections && pair.connections[0].polygon->owner->get_use_edge_connections()) {
+					const uint32_t *region_index = r_build.iter_region_indices.getptr(pair.connections[0].polygon->owner);
+					DEV_ASSERT(region_index != nullptr);
+					r_build.iter_region_free_edges[*region_index].push_back(pair.connections[0]);
+				}
 			}
 		}
 	}
-}
 
-void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
+	// Put the free edges of every region in a stable order and hash them, so unchanged ones can be recognized in the next build.
+	for (uint32_t region_index = 0; region_index < r_build.iter_region_free_edges.size(); region_index++) {
+		LocalVector<Connection> &free_edges = r_build.iter_region_free_edges[region_index];
+		free_edges.sort_custom<FreeEdgeSort>();
 
-	real_t edge_connection_margin = r_build.edge_connection_margin;
-
-	LocalVector<Connection> &free_edges = r_build.iter_free_edges;
-	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
+		uint32_t hash = hash_murmur3_one_32(free_edges.size());
+		for (const Connection &free_edge : free_edges) {
+			hash = hash_murmur3_one_32(free_edge.polygon->id, hash);
+			hash = hash_murmur3_one_32(free_edge.edge, hash);
+		}
+		r_build.iter_region_free_edges_hashes[region_index] = hash_fmix32(hash);
+	}
+}
 
-	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+void NavMapBuilder3D::_build_region_pair_connections(NavMapIterationBuild3D &r_build, const NavMapIterationBuild3D::DirtyRegionPair &p_pair) {
+	const LocalVector<Connection> &free_edges = r_build.iter_region_free_edges[p_pair.from_index];
+	const LocalVector<Connection> &other_edges = r_build.iter_region_free_edges[p_pair.to_index];
+	LocalVector<Pair<uint32_t, Connection>> &connections = p_pair.connections->connections;
 
-	// Find the compatible near edges.
-	//
-	// Note:
-	// Considering that the edges must be compatible (for obvious reasons)
-	// to be connected, create new polygons to remove that small gap is
-	// not really useful and would result in wasteful computation during
-	// connection, integration and path finding.
-	performance_data.pm_edge_free_count = free_edges.size();
+	connections.clear();
 
-	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
+	const real_t edge_connection_margin_squared = r_build.edge_connection_margin * r_build.edge_connection_margin;
 
-	for (uint32_t i = 0; i < free_edges.size(); i++) {
-		const Connection &free_edge = free_edges[i];
+	for (const Connection &free_edge : free_edges) {
 		const Vector3 &edge_p1 = free_edge.pathway_start;
 		const Vector3 &edge_p2 = free_edge.pathway_end;
 
-		for (uint32_t j = 0; j < free_edges.size(); j++) {
-			const Connection &other_edge = free_edges[j];
-			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-				continue;
-			}
-
+		for (const Connection &other_edge : other_edges) {
 			const Vector3 &other_edge_p1 = other_edge.pathway_start;
 			const Vector3 &other_edge_p2 = other_edge.pathway_end;
 
@@ -258,11 +350,165 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 			Connection new_connection = other_edge;
 			new_connection.pathway_start = (self1 + other1) / 2.0;
 			new_connection.pathway_end = (self2 + other2) / 2.0;
-			//free_edge.polygon->connections.push_back(new_connection);
+			connections.push_back(Pair<uint32_t, Connection>(free_edge.polygon->id, new_connection));
+		}
+	}
+}
+
+void NavMapBuilder3D::_build_region_pair_connections_task(void *p_arg) {
+	NavMapBuilderTask3D *task = static_cast<NavMapBuilderTask3D *>(p_arg);
+	NavMapIterationBuild3D &build = *task->build;
+
+	for (uint32_t i = task->index; i < build.iter_dirty_region_pairs.size(); i += task->count) {
+		_build_region_pair_connections(build, build.iter_dirty_region_pairs[i]);
+	}
+}
+
+void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build) {
+	PerformanceData &performance_data = r_build.performance_data;
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	real_t edge_connection_margin = r_build.edge_connection_margin;
+
+	const LocalVector<Ref<NavRegionIteration3D>> &regions = map_iteration->region_iterations;
+	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
+
+	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+
+	HashMap<NavRegionPairKey3D, NavRegionPairConnections3D, NavRegionPairKey3D> &region_pair_connections = r_build.region_pair_connections;
+
+	// Find the compatible near edges.
+	//
+	// Note:
+	// Considering that the edges must be compatible (for obvious reasons)
+	// to be connected, create new polygons to remove that small gap is
+	// not really useful and would result in wasteful computation during
+	// connection, integration and path finding.
+	int free_edge_count = 0;
+	for (const LocalVector<Connection> &free_edges : r_build.iter_region_free_edges) {
+		free_edge_count += free_edges.size();
+	}
+	performance_data.pm_edge_free_count = free_edge_count;
+
+	if (r_build.region_pair_connections_margin != edge_connection_margin) {
+		region_pair_connections.clear();
+		r_build.region_pair_connections_margin = edge_connection_margin;
+	}
+
+	// Only regions whose bounds are within the margin of each other can have edges to connect.
+	// Sweep over the regions sorted along the x-axis to find those pairs.
+	LocalVector<Pair<real_t, uint32_t>> sorted_regions;
+	for (uint32_t region_index = 0; region_index < regions.size(); region_index++) {
+		if (!r_build.iter_region_free_edges[region_index].is_empty()) {
+			sorted_regions.push_back(Pair<real_t, uint32_t>(regions[region_index]->get_bounds().position.x, region_index));
+		}
+	}
+	sorted_regions.sort_custom<PairSort<real_t, uint32_t>>();
+
+	LocalVector<Pair<uint32_t, uint32_t>> region_pairs;
+	for (uint32_t i = 0; i < sorted_regions.size(); i++) {
+		const uint32_t region_index = sorted_regions[i].second;
+		const AABB region_bounds = regions[region_index]->get_bounds().grow(edge_connection_margin);
+		const real_t region_end_x = region_bounds.get_end().x;
+
+		for (uint32_t j = i + 1; j < sorted_regions.size() && sorted_regions[j].first <= region_end_x; j++) {
+			const uint32_t other_region_index = sorted_regions[j].second;
+			if (region_bounds.intersects_inclusive(regions[other_region_index]->get_bounds())) {
+				region_pairs.push_back(Pair<uint32_t, uint32_t>(region_index, other_region_index));
+				region_pairs.push_back(Pair<uint32_t, uint32_t>(other_region_index, region_index));
+			}
+		}
+	}
+	region_pairs.sort_custom<PairSort<uint32_t, uint32_t>>();
+
+	// Reuse the connections of region pairs that did not change since the last build.
+	LocalVector<NavRegionPairConnections3D *> pair_connections;
+	pair_connections.resize(region_pairs.size());
+	r_build.iter_dirty_region_pairs.clear();
+	uint64_t edge_test_count = 0;
+
+	for (uint32_t i = 0; i < region_pairs.size(); i++) {
+		const uint32_t from_index = region_pairs[i].first;
+		const uint32_t to_index = region_pairs[i].second;
+
+		NavRegionPairKey3D key;
+		key.from = regions[from_index].ptr();
+		key.to = regions[to_index].ptr();
+
+		HashMap<NavRegionPairKey3D, NavRegionPairConnections3D, NavRegionPairKey3D>::Iterator E = region_pair_connections.find(key);
+		if (!E) {
+			E = region_pair_connections.insert(key, NavRegionPairConnections3D());
+			E->value.from_region = regions[from_index];
+			E->value.to_region = regions[to_index];
+			E->value.build_pass = 0;
+		}
+
+		NavRegionPairConnections3D &connections = E->value;
+		const uint32_t from_free_edges_hash = r_build.iter_region_free_edges_hashes[from_index];
+		const uint32_t to_free_edges_hash = r_build.iter_region_free_edges_hashes[to_index];
+		if (connections.build_pass == 0 || connections.from_free_edges_hash != from_free_edges_hash || connections.to_free_edges_hash != to_free_edges_hash) {
+			connections.from_free_edges_hash = from_free_edges_hash;
+			connections.to_free_edges_hash = to_free_edges_hash;
+
+			NavMapIterationBuild3D::DirtyRegionPair dirty_pair;
+			dirty_pair.connections = &connections;
+			dirty_pair.from_index = from_index;
+			dirty_pair.to_index = to_index;
+			r_build.iter_dirty_region_pairs.push_back(dirty_pair);
+
+			edge_test_count += (uint64_t)r_build.iter_region_free_edges[from_index].size() * r_build.iter_region_free_edges[to_index].size();
+		}
+		connections.build_pass = r_build.build_pass;
+		pair_connections[i] = &connections;
+	}
+
+	// Drop the pairs that are gone, releasing the region iterations that they keep alive.
+	LocalVector<NavRegionPairKey3D> stale_keys;
+	for (const KeyValue<NavRegionPairKey3D, NavRegionPairConnections3D> &E : region_pair_connections) {
+		if (E.value.build_pass != r_build.build_pass) {
+			stale_keys.push_back(E.key);
+		}
+	}
+	for (const NavRegionPairKey3D &key : stale_keys) {
+		region_pair_connections.erase(key);
+	}
+
+	const uint32_t dirty_pair_count = r_build.iter_dirty_region_pairs.size();
+#ifdef TESTS_ENABLED
+	built_region_pair_count.add(dirty_pair_count);
+#endif // TESTS_ENABLED
+	if (dirty_pair_count > 1 && edge_test_count >= REGION_PAIR_PARALLEL_EDGE_TESTS) {
+		const uint32_t task_count = MIN(dirty_pair_count, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+		LocalVector<NavMapBuilderTask3D> tasks;
+		tasks.resize(task_count);
+		for (uint32_t i = 0; i < task_count; i++) {
+			tasks[i].build = &r_build;
+			tasks[i].index = i;
+			tasks[i].count = task_count;
+			tasks[i].task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMapBuilder3D::_build_region_pair_connections_task, &tasks[i], true, SNAME("NavMapBuilder3DEdgeMargin"));
+		}
+		for (const NavMapBuilderTask3D &task : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task.task_id);
+		}
+	} else {
+		for (const NavMapIterationBuild3D::DirtyRegionPair &dirty_pair : r_build.iter_dirty_region_pairs) {
+			_build_region_pair_connections(r_build, dirty_pair);
+		}
+	}
 
+	for (const NavRegionPairConnections3D *connections : pair_connections) {
+		if (connections->connections.is_empty()) {
+			continue;
+		}
+
+		const NavBaseIteration3D *from_region = connections->from_region.ptr();
+		LocalVector<Connection> &external_connections = region_external_connections[from_region];
+		LocalVector<LocalVector<Connection>> &polygons_external_connections = navbases_polygons_external_connections[from_region];
+
+		for (const Pair<uint32_t, Connection> &connection : connections->connections) {
 			// Add the connection to the region_connection map.
-			region_external_connections[free_edge.polygon->owner].push_back(new_connection);
-			navbases_polygons_external_connections[free_edge.polygon->owner][free_edge.polygon->id].push_back(new_connection);
+			external_connections.push_back(connection.second);
+			polygons_external_connections[connection.first].push_back(connection.second);
 			performance_data.pm_edge_connection_count += 1;
 		}
 	}
@@ -392,40 +638,359 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
-void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
+uint32_t NavMapBuilder3D::_get_connection_data_hash(const NavMapIterationBuild3D &r_build) {
+	const NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	uint32_t hash = hash_murmur3_one_32(CONNECTION_DATA_VERSION);
+	hash = hash_murmur3_one_real(r_build.merge_rasterizer_cell_size.x, hash);
+	hash = hash_murmur3_one_real(r_build.merge_rasterizer_cell_size.y, hash);
+	hash = hash_murmur3_one_real(r_build.merge_rasterizer_cell_size.z, hash);
+	hash = hash_murmur3_one_32(r_build.use_edge_connections, hash);
+	hash = hash_murmur3_one_real(r_build.edge_connection_margin, hash);
+	hash = hash_murmur3_one_real(r_build.link_connection_radius, hash);
+
+	hash = hash_murmur3_one_32(map_iteration->region_iterations.size(), hash);
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		hash = hash_murmur3_one_32(region->geometry_hash, hash);
+		hash = hash_murmur3_one_32(region->get_use_edge_connections(), hash);
+	}
+
+	hash = hash_murmur3_one_32(map_iteration->link_iterations.size(), hash);
+	for (const Ref<NavLinkIteration3D> &link : map_iteration->link_iterations) {
+		const Vector3 link_start_pos = link->get_start_position();
+		const Vector3 link_end_pos = link->get_end_position();
+		hash = hash_murmur3_one_real(link_start_pos.x, hash);
+		hash = hash_murmur3_one_real(link_start_pos.y, hash);
+		hash = hash_murmur3_one_real(link_start_pos.z, hash);
+		hash = hash_murmur3_one_real(link_end_pos.x, hash);
+		hash = hash_murmur3_one_real(link_end_pos.y, hash);
+		hash = hash_murmur3_one_real(link_end_pos.z, hash);
+		hash = hash_murmur3_one_32(link->is_bidirectional(), hash);
+	}
+
+	return hash_fmix32(hash);
+}
+
+static void _connection_data_put_u32(LocalVector<uint8_t> &r_data, uint32_t p_value) {
+	const uint32_t offset = r_data.size();
+	r_data.resize(offset + 4);
+	encode_uint32(p_value, &r_data[offset]);
+}
+
+static void _connection_data_put_vector3(LocalVector<uint8_t> &r_data, const Vector3 &p_value) {
+	const uint32_t offset = r_data.size();
+	r_data.resize(offset + 12);
+	encode_float(p_value.x, &r_data[offset]);
+	encode_float(p_value.y, &r_data[offset + 4]);
+	encode_float(p_value.z, &r_data[offset + 8]);
+}
+
+static void _connection_data_put_connections(LocalVector<uint8_t> &r_data, const LocalVector<Connection> &p_connections, const AHashMap<const NavBaseIteration3D *, uint32_t> &p_navbase_indices) {
+	_connection_data_put_u32(r_data, p_connections.size());
+	for (const Connection &connection : p_connections) {
+		// Regions and links are stored by their cluster index, which is their index in the map iteration with regions first.
+		const uint32_t *navbase_index = p_navbase_indices.getptr(connection.polygon->owner);
+		_connection_data_put_u32(r_data, navbase_index ? *navbase_index : UINT32_MAX);
+		_connection_data_put_u32(r_data, connection.polygon->id);
+		_connection_data_put_u32(r_data, (uint32_t)connection.edge);
+		_connection_data_put_vector3(r_data, connection.pathway_start);
+		_connection_data_put_vector3(r_data, connection.pathway_end);
+	}
+}
+
+Vector<uint8_t> NavMapBuilder3D::get_connection_data(const NavMapIteration3D &p_map_iteration, const PerformanceData &p_performance_data) {
+	const LocalVector<Ref<NavRegionIteration3D>> &regions = p_map_iteration.region_iterations;
+	const LocalVector<Ref<NavLinkIteration3D>> &links = p_map_iteration.link_iterations;
+
+	LocalVector<uint8_t> data;
+	data.resize(4);
+	memcpy(data.ptr(), CONNECTION_DATA_MAGIC, 4);
+	_connection_data_put_u32(data, CONNECTION_DATA_VERSION);
+	_connection_data_put_u32(data, 0); // Checksum, written once the data is complete.
+	_connection_data_put_u32(data, p_map_iteration.connection_data_hash);
+	_connection_data_put_u32(data, regions.size());
+	_connection_data_put_u32(data, links.size());
+	_connection_data_put_u32(data, p_performance_data.pm_edge_connection_count);
+	_connection_data_put_u32(data, p_performance_data.pm_edge_free_count);
+
+	for (const Polygon &link_polygon : p_map_iteration.navlink_polygons) {
+		_connection_data_put_u32(data, link_polygon.vertices.size());
+		for (const Vector3 &vertex : link_polygon.vertices) {
+			_connection_data_put_vector3(data, vertex);
+		}
+	}
+
+	const LocalVector<LocalVector<Connection>> empty_polygons_connections;
+
+	for (uint32_t navbase_index = 0; navbase_index < regions.size() + links.size(); navbase_index++) {
+		const NavBaseIteration3D *navbase = navbase_index < regions.size() ? (const NavBaseIteration3D *)regions[navbase_index].ptr() : (const NavBaseIteration3D *)links[navbase_index - regions.size()].ptr();
+		const LocalVector<LocalVector<Connection>> *polygons_connections = p_map_iteration.navbases_polygons_external_connections.getptr(navbase);
+		if (polygons_connections == nullptr) {
+			polygons_connections = &empty_polygons_connections;
+		}
+
+		_connection_data_put_u32(data, polygons_connections->size());
+		for (const LocalVector<Connection> &polygon_connections : *polygons_connections) {
+			_connection_data_put_connections(data, polygon_connections, p_map_iteration.navbase_to_cluster);
+		}
+	}
+
+	const LocalVector<Connection> empty_connections;
+
+	for (const Ref<NavRegionIteration3D> &region : regions) {
+		const LocalVector<Connection> *region_connections = p_map_iteration.external_region_connections.getptr(region.ptr());
+		_connection_data_put_connections(data, region_connections ? *region_connections : empty_connections, p_map_iteration.navbase_to_cluster);
+	}
+
+	const uint32_t checksum_data_offset = CONNECTION_DATA_CHECKSUM_OFFSET + 4;
+	encode_uint32(hash_murmur3_buffer(data.ptr() + checksum_data_offset, data.size() - checksum_data_offset), &data[CONNECTION_DATA_CHECKSUM_OFFSET]);
+
+	Vector<uint8_t> connection_data;
+	connection_data.resize(data.size());
+	memcpy(connection_data.ptrw(), data.ptr(), data.size());
+	return connection_data;
+}
+
+struct ConnectionDataReader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t offset = 0;
+	bool failed = false;
+
+	uint32_t get_u32() {
+		if (offset + 4 > size) {
+			failed = true;
+			return 0;
+		}
+		const uint32_t value = decode_uint32(&data[offset]);
+		offset += 4;
+		return value;
+	}
+
+	Vector3 get_vector3() {
+		if (offset + 12 > size) {
+			failed = true;
+			return Vector3();
+		}
+		const Vector3 value(decode_float(&data[offset]), decode_float(&data[offset + 4]), decode_float(&data[offset + 8]));
+		offset += 12;
+		return value;
+	}
+
+	bool get_connections(NavMapIteration3D &p_map_iteration, LocalVector<Connection> &r_connections) {
+		const uint32_t region_count = p_map_iteration.region_iterations.size();
+		const uint32_t navbase_count = region_count + p_map_iteration.link_iterations.size();
+
+		const uint32_t connection_count = get_u32();
+		if (failed || connection_count > (size - offset) / 36) {
+			failed = true;
+			return false;
+		}
+
+		r_connections.resize(connection_count);
+		for (Connection &connection : r_connections) {
+			const uint32_t navbase_index = get_u32();
+			const uint32_t polygon_id = get_u32();
+			connection.edge = (int)get_u32();
+			connection.pathway_start = get_vector3();
+			connection.pathway_end = get_vector3();
+
+			if (navbase_index < region_count && polygon_id < p_map_iteration.region_iterations[navbase_index]->navmesh_polygons.size()) {
+				connection.polygon = &p_map_iteration.region_iterations[navbase_index]->navmesh_polygons[polygon_id];
+			} else if (navbase_index >= region_count && navbase_index < navbase_count && polygon_id == 0) {
+				connection.polygon = &p_map_iteration.navlink_polygons[navbase_index - region_count];
+			} else {
+				failed = true;
+				return false;
+			}
+		}
+		return !failed;
+	}
+};
+
+bool NavMapBuilder3D::_build_step_load_connection_data(NavMapIterationBuild3D &r_build) {
+	const Vector<uint8_t> &connection_data = r_build.connection_data;
+	if (connection_data.is_empty()) {
+		return false;
+	}
+
+	PerformanceData &performance_data = r_build.performance_data;
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
-	map_iteration->navmesh_polygon_count = r_build.polygon_count;
+	const LocalVector<Ref<NavRegionIteration3D>> &regions = map_iteration->region_iterations;
+	const LocalVector<Ref<NavLinkIteration3D>> &links = map_iteration->link_iterations;
 
-	uint32_t navmesh_polygon_count = r_build.polygon_count;
-	uint32_t total_polygon_count = navmesh_polygon_count;
+	ConnectionDataReader reader;
+	reader.data = connection_data.ptr();
+	reader.size = connection_data.size();
+
+	// The map drops data flagged as corrupted, so the errors below are printed once.
+	r_build.connection_data_corrupted = true;
+	ERR_FAIL_COND_V_MSG(reader.size < 4 || memcmp(reader.data, CONNECTION_DATA_MAGIC, 4) != 0, false, "Invalid navigation map connection data.");
+	reader.offset = 4;
+	ERR_FAIL_COND_V_MSG(reader.get_u32() != CONNECTION_DATA_VERSION, false, "Unsupported navigation map connection data version.");
+	const uint32_t checksum = reader.get_u32();
+	ERR_FAIL_COND_V_MSG(reader.failed || checksum != hash_murmur3_buffer(reader.data + reader.offset, reader.size - reader.offset), false, "Corrupted navigation map connection data.");
+	r_build.connection_data_corrupted = false;
+
+	if (reader.get_u32() != map_iteration->connection_data_hash || reader.get_u32() != regions.size() || reader.get_u32() != links.size()) {
+		// The data was made for different regions, links or map settings, build the connections instead.
+		return false;
+	}
 
-	map_iteration->path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration->path_query_slots) {
-		p_path_query_slot.traversable_polys.clear();
-		p_path_query_slot.traversable_polys.reserve(navmesh_polygon_count * 0.25);
-		p_path_query_slot.path_corridor.clear();
+	const uint32_t edge_connection_count = reader.get_u32();
+	const uint32_t edge_free_count = reader.get_u32();
 
-		p_path_query_slot.path_corridor.resize(total_polygon_count);
+	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+	HashMap<const NavBaseIteration3D *, LocalVector<Connection>> &region_external_connections = map_iteration->external_region_connections;
 
-		p_path_query_slot.poly_to_id.clear();
-		p_path_query_slot.poly_to_id.reserve(total_polygon_count);
+	LocalVector<Nav3D::Polygon> &navlink_polygons = map_iteration->navlink_polygons;
+	navlink_polygons.clear();
+	navlink_polygons.resize(links.size());
+	for (uint32_t i = 0; i < links.size() && !reader.failed; i++) {
+		Polygon &link_polygon = navlink_polygons[i];
+		link_polygon.id = 0;
+		link_polygon.owner = links[i].ptr();
+
+		const uint32_t vertex_count = reader.get_u32();
+		if (vertex_count > 4) {
+			reader.failed = true;
+			break;
+		}
+		link_polygon.vertices.resize(vertex_count);
+		for (Vector3 &vertex : link_polygon.vertices) {
+			vertex = reader.get_vector3();
+		}
+	}
+
+	for (uint32_t navbase_index = 0; navbase_index < regions.size() + links.size() && !reader.failed; navbase_index++) {
+		const bool is_region = navbase_index < regions.size();
+		const NavBaseIteration3D *navbase = is_region ? (const NavBaseIteration3D *)regions[navbase_index].ptr() : (const NavBaseIteration3D *)links[navbase_index - regions.size()].ptr();
+
+		const uint32_t polygons_connections_count = reader.get_u32();
+		if (is_region ? polygons_connections_count != regions[navbase_index]->navmesh_polygons.size() : polygons_connections_count > 2) {
+			reader.failed = true;
+			break;
+		}
+		if (polygons_connections_count == 0) {
+			continue;
+		}
 
-		int polygon_id = 0;
-		for (Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
-			for (const Polygon &polygon : region->navmesh_polygons) {
-				p_path_query_slot.poly_to_id[&polygon] = polygon_id;
-				polygon_id++;
+		LocalVector<LocalVector<Connection>> &polygons_connections = navbases_polygons_external_connections[navbase];
+		polygons_connections.resize(polygons_connections_count);
+		for (LocalVector<Connection> &polygon_connections : polygons_connections) {
+			if (!reader.get_connections(*map_iteration, polygon_connections)) {
+				break;
 			}
 		}
+	}
+
+	for (uint32_t region_index = 0; region_index < regions.size() && !reader.failed; region_index++) {
+		reader.get_connections(*map_iteration, region_external_connections[regions[region_index].ptr()]);
+	}
+
+	if (reader.failed || reader.offset != reader.size) {
+		// Start over from the state before the connection steps.
+		_build_step_gather_region_polygons(r_build);
+		r_build.connection_data_corrupted = true;
+		ERR_FAIL_V_MSG(false, "Corrupted navigation map connection data.");
+	}
+
+	performance_data.pm_edge_connection_count = edge_connection_count;
+	performance_data.pm_edge_free_count = edge_free_count;
+	r_build.polygon_count += links.size();
+	r_build.connection_data_loaded = true;
+	performance_data.pm_connection_data_loaded = true;
+
+	return true;
+}
+
+void NavMapBuilder3D::_build_step_navbase_clusters(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<NavBaseCluster> &navbase_clusters = map_iteration->navbase_clusters;
+	AHashMap<const NavBaseIteration3D *, uint32_t> &navbase_to_cluster = map_iteration->navbase_to_cluster;
+
+	navbase_clusters.clear();
+	navbase_to_cluster.clear();
+
+	const uint32_t cluster_count = map_iteration->region_iterations.size() + map_iteration->link_iterations.size();
+	navbase_clusters.resize(cluster_count);
+	navbase_to_cluster.reserve(cluster_count);
+
+	// Every region and link is a cluster.
+	uint32_t cluster_index = 0;
+	uint32_t polygon_offset = 0;
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		navbase_clusters[cluster_index].navbase = region.ptr();
+		navbase_clusters[cluster_index].polygon_offset = polygon_offset;
+		navbase_to_cluster.insert(region.ptr(), cluster_index);
+		cluster_index++;
+		polygon_offset += region->navmesh_polygons.size();
+	}
+	// Links have a single polygon in `navlink_polygons`.
+	for (const Ref<NavLinkIteration3D> &link : map_iteration->link_iterations) {
+		navbase_clusters[cluster_index].navbase = link.ptr();
+		navbase_clusters[cluster_index].polygon_offset = polygon_offset;
+		navbase_to_cluster.insert(link.ptr(), cluster_index);
+		cluster_index++;
+		polygon_offset += 1;
+	}
+
+	// Collapse all external connections between two clusters into a single portal placed at their average pathway center.
+	AHashMap<uint32_t, uint32_t> portal_indices;
+	LocalVector<uint32_t> portal_connection_counts;
+
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &E : map_iteration->navbases_polygons_external_connections) {
+		const uint32_t *from_cluster_index = navbase_to_cluster.getptr(E.key);
+		if (from_cluster_index == nullptr) {
+			continue;
+		}
+		NavBaseCluster &from_cluster = navbase_clusters[*from_cluster_index];
+
+		portal_indices.clear();
+		portal_connection_counts.clear();
 
-		for (const Polygon &polygon : map_iteration->navlink_polygons) {
-			p_path_query_slot.poly_to_id[&polygon] = polygon_id;
-			polygon_id++;
+		for (const LocalVector<Connection> &polygon_connections : E.value) {
+			for (const Connection &connection : polygon_connections) {
+				const uint32_t *to_cluster_index = navbase_to_cluster.getptr(connection.polygon->owner);
+				if (to_cluster_index == nullptr || *to_cluster_index == *from_cluster_index) {
+					continue;
+				}
+
+				const Vector3 pathway_center = (connection.pathway_start + connection.pathway_end) * 0.5;
+
+				uint32_t *portal_index = portal_indices.getptr(*to_cluster_index);
+				if (portal_index == nullptr) {
+					ClusterPortal portal;
+					portal.cluster = *to_cluster_index;
+					portal.position = pathway_center;
+					portal_indices.insert(*to_cluster_index, from_cluster.portals.size());
+					from_cluster.portals.push_back(portal);
+					portal_connection_counts.push_back(1);
+				} else {
+					from_cluster.portals[*portal_index].position += pathway_center;
+					portal_connection_counts[*portal_index] += 1;
+				}
+			}
 		}
 
-		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+		for (uint32_t i = 0; i < from_cluster.portals.size(); i++) {
+			from_cluster.portals[i].position /= portal_connection_counts[i];
+		}
 	}
+}
+
+void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	map_iteration->navmesh_polygon_count = r_build.polygon_count;
 
+	// The slots are prepared by the path queries that use them, many maps never run more than one query at a time.
+	// Slots that no query used during the last iteration of this map slot free their buffers.
+	map_iteration->path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration->path_query_slots) {
+		NavMeshQueries3D::path_query_slot_release(p_path_query_slot);
+	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
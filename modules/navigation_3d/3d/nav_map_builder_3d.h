@@ -32,18 +32,39 @@
 
 #include "../nav_utils_3d.h"
 
-struct NavMapIterationBuild3D;
+#include "nav_map_iteration_3d.h"
+
+#include "core/templates/safe_refcount.h"
 
 class NavMapBuilder3D {
+#ifdef TESTS_ENABLED
+	static SafeNumeric<uint64_t> built_region_pair_count;
+#endif // TESTS_ENABLED
+
 	static void _build_step_gather_region_polygons(NavMapIterationBuild3D &r_build);
 	static void _build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
+	static void _build_step_navbase_clusters(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
+	static void _build_edge_shard(NavMapIterationBuild3D &r_build, uint32_t p_shard_index);
+	static void _build_edge_shard_task(void *p_arg);
+	static void _build_region_pair_connections(NavMapIterationBuild3D &r_build, const NavMapIterationBuild3D::DirtyRegionPair &p_pair);
+	static void _build_region_pair_connections_task(void *p_arg);
+
+	static uint32_t _get_connection_data_hash(const NavMapIterationBuild3D &r_build);
+	static bool _build_step_load_connection_data(NavMapIterationBuild3D &r_build);
+
 public:
 	static Nav3D::PointKey get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size);
 
 	static void build_navmap_iteration(NavMapIterationBuild3D &r_build);
+
+#ifdef TESTS_ENABLED
+	static uint64_t get_built_region_pair_count();
+#endif // TESTS_ENABLED
+
+	static Vector<uint8_t> get_connection_data(const NavMapIteration3D &p_map_iteration, const Nav3D::PerformanceData &p_performance_data);
 };
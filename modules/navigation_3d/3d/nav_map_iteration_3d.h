@@ -36,13 +36,44 @@
 #include "core/math/math_defs.h"
 #include "core/os/rw_lock.h"
 #include "core/os/semaphore.h"
+#include "core/templates/lru.h"
+#include "core/templates/pair.h"
 
 class NavLinkIteration3D;
 class NavRegion3D;
 class NavRegionIteration3D;
 struct NavMapIteration3D;
 
+// The edge connection margin connections from the free edges of one region to the free edges of another.
+// Kept between map builds and reused as long as both regions and their free edges did not change.
+struct NavRegionPairConnections3D {
+	Ref<NavRegionIteration3D> from_region;
+	Ref<NavRegionIteration3D> to_region;
+	uint32_t from_free_edges_hash = 0;
+	uint32_t to_free_edges_hash = 0;
+	uint64_t build_pass = 0;
+
+	// The polygon id in `from_region` paired with the connection that leads from it into `to_region`.
+	LocalVector<Pair<uint32_t, Nav3D::Connection>> connections;
+};
+
+struct NavRegionPairKey3D {
+	const NavBaseIteration3D *from = nullptr;
+	const NavBaseIteration3D *to = nullptr;
+
+	static uint32_t hash(const NavRegionPairKey3D &p_val) {
+		return hash_murmur3_one_64((uint64_t)p_val.to, hash_murmur3_one_64((uint64_t)p_val.from));
+	}
+
+	bool operator==(const NavRegionPairKey3D &p_key) const {
+		return from == p_key.from && to == p_key.to;
+	}
+};
+
 struct NavMapIterationBuild3D {
+	// The edge keys are spread over this many maps so that they can be grouped in parallel.
+	static constexpr uint32_t EDGE_SHARD_COUNT = 8;
+
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
@@ -51,8 +82,34 @@ struct NavMapIterationBuild3D {
 	int polygon_count = 0;
 	int free_edge_count = 0;
 
-	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
-	LocalVector<Nav3D::Connection> iter_free_edges;
+	struct EdgeShard {
+		HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> connection_pairs_map;
+		int edge_count = 0;
+		int free_edge_count = 0;
+		int edge_merge_error_count = 0;
+	};
+	EdgeShard iter_edge_shards[EDGE_SHARD_COUNT];
+
+	// Free edges and their hash per entry of `NavMapIteration3D::region_iterations`.
+	LocalVector<LocalVector<Nav3D::Connection>> iter_region_free_edges;
+	LocalVector<uint32_t> iter_region_free_edges_hashes;
+	AHashMap<const NavBaseIteration3D *, uint32_t> iter_region_indices;
+
+	struct DirtyRegionPair {
+		NavRegionPairConnections3D *connections = nullptr;
+		uint32_t from_index = 0;
+		uint32_t to_index = 0;
+	};
+
+	HashMap<NavRegionPairKey3D, NavRegionPairConnections3D, NavRegionPairKey3D> region_pair_connections;
+	LocalVector<DirtyRegionPair> iter_dirty_region_pairs;
+	real_t region_pair_connections_margin = 0.0;
+	uint64_t build_pass = 0;
+
+	// Connection data from an earlier build that is loaded instead of connecting the regions and links when it matches the map.
+	Vector<uint8_t> connection_data;
+	bool connection_data_loaded = false;
+	bool connection_data_corrupted = false;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
@@ -61,10 +118,20 @@ struct NavMapIterationBuild3D {
 	void reset() {
 		performance_data.reset();
 
-		iter_connection_pairs_map.clear();
-		iter_free_edges.clear();
+		for (EdgeShard &shard : iter_edge_shards) {
+			shard.connection_pairs_map.clear();
+			shard.edge_count = 0;
+			shard.free_edge_count = 0;
+			shard.edge_merge_error_count = 0;
+		}
+		iter_region_free_edges.clear();
+		iter_region_free_edges_hashes.clear();
+		iter_region_indices.clear();
+		iter_dirty_region_pairs.clear();
 		polygon_count = 0;
 		free_edge_count = 0;
+		connection_data_loaded = false;
+		connection_data_corrupted = false;
 
 		navmesh_polygon_count = 0;
 	}
@@ -81,12 +148,29 @@ struct NavMapIteration3D {
 
 	int navmesh_polygon_count = 0;
 
+	// Identifies the map settings, regions and links that the connections were built from.
+	uint32_t connection_data_hash = 0;
+
 	// The edge connections that the map builds on top with the edge connection margin.
 	HashMap<const NavBaseIteration3D *, LocalVector<Nav3D::Connection>> external_region_connections;
 	HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> navbases_polygons_external_connections;
 
 	LocalVector<Nav3D::Polygon> navlink_polygons;
 
+	// The abstract graph of regions and links that the hierarchical path search runs on before refining on polygons.
+	LocalVector<Nav3D::NavBaseCluster> navbase_clusters;
+	AHashMap<const NavBaseIteration3D *, uint32_t> navbase_to_cluster;
+
+	// Flow fields are built on demand by queries and live as long as the iteration.
+	mutable HashMap<Nav3D::FlowFieldKey, Nav3D::FlowField *, Nav3D::FlowFieldKey> flow_fields;
+	mutable Mutex flow_fields_mutex;
+	// Built with the first flow field query, under the flow fields mutex.
+	mutable Nav3D::PolygonGrid flow_field_polygon_grid;
+
+	// Path corridors found by earlier path queries, reused by queries between the same polygons. Disabled with a capacity of 0.
+	mutable LRUCache<Nav3D::PathCorridorKey, Nav3D::PathCorridor, Nav3D::PathCorridorKey> path_corridor_cache;
+	mutable Mutex path_corridor_cache_mutex;
+
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
@@ -96,14 +180,37 @@ struct NavMapIteration3D {
 	void clear() {
 		map_up = Vector3();
 		navmesh_polygon_count = 0;
+		connection_data_hash = 0;
 
 		region_iterations.clear();
 		link_iterations.clear();
 		external_region_connections.clear();
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
+		navbase_clusters.clear();
+		navbase_to_cluster.clear();
+		clear_flow_fields();
+		flow_field_polygon_grid.built.clear();
+		flow_field_polygon_grid.cell_offsets.clear();
+		flow_field_polygon_grid.cell_polygons.clear();
+		path_corridor_cache.clear();
 		region_ptr_to_region_iteration.clear();
 	}
+
+	void clear_flow_fields() const {
+		MutexLock lock(flow_fields_mutex);
+		for (const KeyValue<Nav3D::FlowFieldKey, Nav3D::FlowField *> &E : flow_fields) {
+			// Queries still reading the field keep it alive until they are done.
+			if (E.value->refcount.unref()) {
+				memdelete(E.value);
+			}
+		}
+		flow_fields.clear();
+	}
+
+	~NavMapIteration3D() {
+		clear_flow_fields();
+	}
 };
 
 class NavMapIterationRead3D {
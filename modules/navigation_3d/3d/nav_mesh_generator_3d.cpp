@@ -49,6 +49,11 @@ bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshGeneratorTileCache3D> NavMeshGenerator3D::tile_caches;
+#ifdef TESTS_ENABLED
+SafeNumeric<uint64_t> NavMeshGenerator3D::baked_tile_count;
+#endif // TESTS_ENABLED
 
 static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MAX] = {
 	"",
@@ -134,6 +139,11 @@ void NavMeshGenerator3D::cleanup() {
 		}
 		generator_tasks.clear();
 
+		{
+			MutexLock tile_cache_lock(tile_cache_mutex);
+			tile_caches.clear();
+		}
+
 		generator_parsers_rwlock.write_lock();
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
@@ -248,6 +258,13 @@ String NavMeshGenerator3D::get_baking_state_msg(Ref<NavigationMesh> p_navigation
 	return bake_state_msg;
 }
 
+#ifdef TESTS_ENABLED
+uint64_t NavMeshGenerator3D::get_baked_tile_count() {
+	// Tiles reused from the tile cache are not counted, only tiles that went through Recast.
+	return baked_tile_count.get();
+}
+#endif // TESTS_ENABLED
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -323,13 +340,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
 
 	const float *verts = source_geometry_vertices.ptr();
@@ -337,9 +347,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 	const int *tris = source_geometry_indices.ptr();
 	const int ntris = source_geometry_indices.size() / 3;
 
-	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
-
 	rcConfig cfg;
 	memset(&cfg, 0, sizeof(cfg));
 
@@ -388,6 +395,20 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
 	}
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles_from_source_geometry_data(p_generator_task, cfg, source_geometry_vertices, source_geometry_indices, projected_obstructions);
+		return;
+	}
+
+	{
+		// Baking without tiles, tiles cached from a previous bake are now outdated.
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		tile_caches.erase(p_navigation_mesh->get_instance_id());
+	}
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
 	cfg.bmin[0] = bmin[0];
 	cfg.bmin[1] = bmin[1];
 	cfg.bmin[2] = bmin[2];
@@ -420,23 +441,45 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	if (!generator_build_recast_navmesh(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, p_generator_task->bake_state, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+bool NavMeshGenerator3D::generator_build_recast_navmesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState &r_bake_state, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	const rcConfig &cfg = p_cfg;
+
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	r_bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
@@ -449,19 +492,19 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -476,13 +519,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+	r_bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -497,43 +540,40 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+	r_bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea), false);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	r_bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
 
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
@@ -547,7 +587,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -571,19 +611,425 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+	r_bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
 
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
+	return true;
+}
+
+struct NavMeshGenerator3D::NavMeshGeneratorTileBakeTask3D {
+	Ref<NavigationMesh> navigation_mesh;
+	rcConfig cfg;
+	const float *verts = nullptr;
+	int nverts = 0;
+	LocalVector<int> tris;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	Vector2i coords;
+	uint32_t hash = 0;
+	WorkerThreadPool::TaskID thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
+
+	NavMeshBakeState bake_state = NavMeshBakeState::BAKE_STATE_NONE;
+	bool success = false;
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg) {
+	NavMeshGeneratorTileBakeTask3D *tile_task = static_cast<NavMeshGeneratorTileBakeTask3D *>(p_arg);
+
+#ifdef TESTS_ENABLED
+	baked_tile_count.increment();
+#endif // TESTS_ENABLED
+	tile_task->success = generator_build_recast_navmesh(tile_task->navigation_mesh, tile_task->cfg, tile_task->verts, tile_task->nverts, tile_task->tris.ptr(), tile_task->tris.size() / 3, tile_task->projected_obstructions, tile_task->bake_state, tile_task->vertices, tile_task->polygons);
+}
+
+void NavMeshGenerator3D::generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task, const rcConfig &p_cfg, const Vector<float> &p_vertices, const Vector<int> &p_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions) {
+	const Ref<NavigationMesh> &navigation_mesh = p_generator_task->navigation_mesh;
+	const ObjectID navigation_mesh_id = navigation_mesh->get_instance_id();
+
+	const float *verts = p_vertices.ptr();
+	const int nverts = p_vertices.size() / 3;
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	const float cs = p_cfg.cs;
+	const float ch = p_cfg.ch;
+
+	// Tiles are aligned to the world origin so that tile coordinates stay stable when the source geometry bounds change.
+	const int tile_cells = MAX(1, (int)Math::floor(navigation_mesh->get_tile_size() / cs));
+	const float tile_world_size = tile_cells * cs;
+
+	// Each tile sees the geometry of its neighbors inside the border so erosion and region partitioning match at the tile edges.
+	const int tile_border = MAX(p_cfg.borderSize, p_cfg.walkableRadius + 3);
+	const float tile_border_size = tile_border * cs;
+
+	rcConfig tile_cfg = p_cfg;
+	tile_cfg.tileSize = tile_cells;
+	tile_cfg.borderSize = tile_border;
+
+	// The config only holds bake settings at this point, any change invalidates all cached tiles.
+	uint32_t settings_hash = hash_murmur3_buffer(&tile_cfg, sizeof(rcConfig));
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	AABB baking_aabb = navigation_mesh->get_filter_baking_aabb();
+	const bool use_baking_aabb = baking_aabb.has_volume();
+	if (use_baking_aabb) {
+		baking_aabb.position += navigation_mesh->get_filter_baking_aabb_offset();
+		for (int i = 0; i < 3; i++) {
+			bmin[i] = baking_aabb.position[i];
+			bmax[i] = baking_aabb.position[i] + baking_aabb.size[i];
+			settings_hash = hash_murmur3_one_float(bmin[i], settings_hash);
+			settings_hash = hash_murmur3_one_float(bmax[i], settings_hash);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
+
+	const Vector2i tile_min = Vector2i((int)Math::floor(bmin[0] / tile_world_size), (int)Math::floor(bmin[2] / tile_world_size));
+	const Vector2i tile_max = Vector2i((int)Math::floor(bmax[0] / tile_world_size), (int)Math::floor(bmax[2] / tile_world_size));
+	const int tiles_x = tile_max.x - tile_min.x + 1;
+	const int tiles_z = tile_max.y - tile_min.y + 1;
+
+	if ((int64_t)tiles_x * tiles_z > 1000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nSource geometry is suspiciously big for the current Tile Size in the NavMesh Resource bake settings."
+					 "\nIt is advised to increase Tile Size or reduce the size / scale of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+	}
+
+	// Bin the source triangles into all tiles they overlap including the tile border.
+	LocalVector<LocalVector<int>> tile_triangles;
+	tile_triangles.resize(tiles_x * tiles_z);
+	LocalVector<Vector2> tile_height_ranges;
+	tile_height_ranges.resize(tiles_x * tiles_z);
+	for (Vector2 &tile_height_range : tile_height_ranges) {
+		tile_height_range = Vector2(Math::INF, -Math::INF);
+	}
+
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+
+		const int x_begin = MAX(tile_min.x, (int)Math::floor((MIN(v0[0], MIN(v1[0], v2[0])) - tile_border_size) / tile_world_size));
+		const int x_end = MIN(tile_max.x, (int)Math::floor((MAX(v0[0], MAX(v1[0], v2[0])) + tile_border_size) / tile_world_size));
+		const int z_begin = MAX(tile_min.y, (int)Math::floor((MIN(v0[2], MIN(v1[2], v2[2])) - tile_border_size) / tile_world_size));
+		const int z_end = MIN(tile_max.y, (int)Math::floor((MAX(v0[2], MAX(v1[2], v2[2])) + tile_border_size) / tile_world_size));
+		const float y_min = MIN(v0[1], MIN(v1[1], v2[1]));
+		const float y_max = MAX(v0[1], MAX(v1[1], v2[1]));
+
+		for (int z = z_begin; z <= z_end; z++) {
+			for (int x = x_begin; x <= x_end; x++) {
+				const int tile_index = (z - tile_min.y) * tiles_x + (x - tile_min.x);
+				tile_triangles[tile_index].push_back(i);
+				tile_height_ranges[tile_index].x = MIN(tile_height_ranges[tile_index].x, y_min);
+				tile_height_ranges[tile_index].y = MAX(tile_height_ranges[tile_index].y, y_max);
+			}
+		}
+	}
+
+	LocalVector<Rect2> obstruction_rects;
+	obstruction_rects.resize(p_projected_obstructions.size());
+	for (int i = 0; i < p_projected_obstructions.size(); i++) {
+		const Vector<float> &obstruction_vertices = p_projected_obstructions[i].vertices;
+		if (obstruction_vertices.size() < 3) {
+			continue;
+		}
+		obstruction_rects[i] = Rect2(obstruction_vertices[0], obstruction_vertices[2], 0.0, 0.0);
+		for (int j = 3; j + 2 < obstruction_vertices.size(); j += 3) {
+			obstruction_rects[i].expand_to(Vector2(obstruction_vertices[j], obstruction_vertices[j + 2]));
+		}
+	}
+
+	// Take the cached tiles out while baking, only one bake per navigation mesh can run at a time.
+	NavMeshGeneratorTileCache3D tile_cache;
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+
+		LocalVector<ObjectID> stale_tile_caches;
+		for (const KeyValue<ObjectID, NavMeshGeneratorTileCache3D> &E : tile_caches) {
+			if (ObjectDB::get_instance(E.key) == nullptr) {
+				stale_tile_caches.push_back(E.key);
+			}
+		}
+		for (const ObjectID &stale_tile_cache : stale_tile_caches) {
+			tile_caches.erase(stale_tile_cache);
+		}
+
+		NavMeshGeneratorTileCache3D *existing_tile_cache = tile_caches.getptr(navigation_mesh_id);
+		if (existing_tile_cache && existing_tile_cache->settings_hash == settings_hash) {
+			tile_cache = std::move(*existing_tile_cache);
+		}
+		tile_caches.erase(navigation_mesh_id);
+	}
+	tile_cache.settings_hash = settings_hash;
+
+	HashMap<Vector2i, NavMeshGeneratorTile3D> baked_tiles;
+	LocalVector<NavMeshGeneratorTileBakeTask3D *> tile_tasks;
+
+	for (int z = tile_min.y; z <= tile_max.y; z++) {
+		for (int x = tile_min.x; x <= tile_max.x; x++) {
+			const int tile_index = (z - tile_min.y) * tiles_x + (x - tile_min.x);
+			const LocalVector<int> &triangles = tile_triangles[tile_index];
+			if (triangles.is_empty()) {
+				continue;
+			}
+
+			float tile_bmin[3] = { x * tile_world_size, tile_height_ranges[tile_index].x, z * tile_world_size };
+			float tile_bmax[3] = { (x + 1) * tile_world_size, tile_height_ranges[tile_index].y, (z + 1) * tile_world_size };
+			if (use_baking_aabb) {
+				tile_bmin[0] = MAX(tile_bmin[0], bmin[0]);
+				tile_bmin[2] = MAX(tile_bmin[2], bmin[2]);
+				tile_bmax[0] = MIN(tile_bmax[0], bmax[0]);
+				tile_bmax[2] = MIN(tile_bmax[2], bmax[2]);
+				tile_bmin[1] = bmin[1];
+				tile_bmax[1] = bmax[1];
+			} else {
+				// Keep the heightfield origin on the cell height grid so border vertices of neighbor tiles line up.
+				tile_bmin[1] = Math::floor(tile_bmin[1] / ch) * ch;
+			}
+			if (tile_bmin[0] >= tile_bmax[0] || tile_bmin[2] >= tile_bmax[2]) {
+				continue;
+			}
+			tile_bmin[0] -= tile_border_size;
+			tile_bmin[2] -= tile_border_size;
+			tile_bmax[0] += tile_border_size;
+			tile_bmax[2] += tile_border_size;
+
+			const Vector2i coords = Vector2i(x, z);
+			uint32_t tile_hash = hash_murmur3_one_32(x, settings_hash);
+			tile_hash = hash_murmur3_one_32(z, tile_hash);
+			for (int triangle : triangles) {
+				for (int j = 0; j < 3; j++) {
+					tile_hash = hash_murmur3_buffer(&verts[tris[triangle * 3 + j] * 3], 3 * sizeof(float), tile_hash);
+				}
+			}
+
+			const Rect2 tile_rect = Rect2(tile_bmin[0], tile_bmin[2], tile_bmax[0] - tile_bmin[0], tile_bmax[2] - tile_bmin[2]);
+			Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> tile_obstructions;
+			for (int i = 0; i < p_projected_obstructions.size(); i++) {
+				const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction = p_projected_obstructions[i];
+				if (projected_obstruction.vertices.size() < 3 || !tile_rect.intersects(obstruction_rects[i], true)) {
+					continue;
+				}
+				tile_hash = hash_murmur3_buffer(projected_obstruction.vertices.ptr(), projected_obstruction.vertices.size() * sizeof(float), tile_hash);
+				tile_hash = hash_murmur3_one_float(projected_obstruction.elevation, tile_hash);
+				tile_hash = hash_murmur3_one_float(projected_obstruction.height, tile_hash);
+				tile_hash = hash_murmur3_one_32(projected_obstruction.carve, tile_hash);
+				tile_obstructions.push_back(projected_obstruction);
+			}
+
+			const NavMeshGeneratorTile3D *cached_tile = tile_cache.tiles.getptr(coords);
+			if (cached_tile && cached_tile->hash == tile_hash) {
+				baked_tiles.insert(coords, *cached_tile);
+				continue;
+			}
+
+			NavMeshGeneratorTileBakeTask3D *tile_task = memnew(NavMeshGeneratorTileBakeTask3D);
+			tile_task->navigation_mesh = navigation_mesh;
+			tile_task->cfg = tile_cfg;
+			for (int i = 0; i < 3; i++) {
+				tile_task->cfg.bmin[i] = tile_bmin[i];
+				tile_task->cfg.bmax[i] = tile_bmax[i];
+			}
+			rcCalcGridSize(tile_task->cfg.bmin, tile_task->cfg.bmax, cs, &tile_task->cfg.width, &tile_task->cfg.height);
+			tile_task->verts = verts;
+			tile_task->nverts = nverts;
+			tile_task->tris.resize(triangles.size() * 3);
+			for (uint32_t i = 0; i < triangles.size(); i++) {
+				tile_task->tris[i * 3 + 0] = tris[triangles[i] * 3 + 0];
+				tile_task->tris[i * 3 + 1] = tris[triangles[i] * 3 + 1];
+				tile_task->tris[i * 3 + 2] = tris[triangles[i] * 3 + 2];
+			}
+			tile_task->projected_obstructions = tile_obstructions;
+			tile_task->coords = coords;
+			tile_task->hash = tile_hash;
+			tile_tasks.push_back(tile_task);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // steps #3 to #9 for each dirty tile
+
+	if (use_threads && baking_use_multiple_threads && tile_tasks.size() > 1) {
+		for (NavMeshGeneratorTileBakeTask3D *tile_task : tile_tasks) {
+			tile_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake_tile, tile_task, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTile3D"));
+		}
+		for (NavMeshGeneratorTileBakeTask3D *tile_task : tile_tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tile_task->thread_task_id);
+		}
+	} else {
+		for (NavMeshGeneratorTileBakeTask3D *tile_task : tile_tasks) {
+			generator_thread_bake_tile(tile_task);
+		}
+	}
+
+	for (NavMeshGeneratorTileBakeTask3D *tile_task : tile_tasks) {
+		// Failed tiles stay out of the cache so the next bake retries them.
+		if (tile_task->success) {
+			NavMeshGeneratorTile3D tile;
+			tile.hash = tile_task->hash;
+			tile.vertices = tile_task->vertices;
+			tile.polygons = tile_task->polygons;
+			baked_tiles.insert(tile_task->coords, tile);
+		}
+		memdelete(tile_task);
+	}
+	tile_tasks.clear();
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	LocalVector<Vector2i> baked_tile_coords;
+	baked_tile_coords.reserve(baked_tiles.size());
+	for (const KeyValue<Vector2i, NavMeshGeneratorTile3D> &E : baked_tiles) {
+		baked_tile_coords.push_back(E.key);
+	}
+	baked_tile_coords.sort();
+
+	// Weld the tile vertices that neighbor tiles share on their common border.
+	const float weld_size_xz = cs * 0.1f;
+	const float weld_size_y = ch * 0.1f;
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	HashMap<Vector3i, int> welded_vertex_to_index;
+
+	for (const Vector2i &coords : baked_tile_coords) {
+		const NavMeshGeneratorTile3D &tile = baked_tiles[coords];
+
+		LocalVector<int> tile_index_to_native_index;
+		tile_index_to_native_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			const Vector3 &vertex = tile.vertices[i];
+			const Vector3i welded_vertex = Vector3i((int)Math::round(vertex.x / weld_size_xz), (int)Math::round(vertex.y / weld_size_y), (int)Math::round(vertex.z / weld_size_xz));
+			int *existing_index_ptr = welded_vertex_to_index.getptr(welded_vertex);
+			if (!existing_index_ptr) {
+				tile_index_to_native_index[i] = nav_vertices.size();
+				welded_vertex_to_index[welded_vertex] = nav_vertices.size();
+				nav_vertices.push_back(vertex);
+			} else {
+				tile_index_to_native_index[i] = *existing_index_ptr;
+			}
+		}
+
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> nav_polygon;
+			nav_polygon.resize(tile_polygon.size());
+			for (int i = 0; i < tile_polygon.size(); i++) {
+				nav_polygon.write[i] = tile_index_to_native_index[tile_polygon[i]];
+			}
+			nav_polygons.push_back(nav_polygon);
+		}
+	}
+
+	// Neighbor tiles do not necessarily split their common border at the same vertices.
+	// Insert the border vertices of the neighbor into the polygon edges to avoid T-junctions so the edges can connect.
+	HashMap<int, LocalVector<int>> tile_line_vertices[2];
+	const Vector3 *nav_vertices_ptr = nav_vertices.ptr();
+
+	auto get_tile_line = [&](float p_value, int &r_line) -> bool {
+		r_line = (int)Math::round(p_value / tile_world_size);
+		return Math::abs(p_value - r_line * tile_world_size) < weld_size_xz;
+	};
+
+	for (int i = 0; i < nav_vertices.size(); i++) {
+		int line;
+		if (get_tile_line(nav_vertices_ptr[i].x, line)) {
+			tile_line_vertices[0][line].push_back(i);
+		}
+		if (get_tile_line(nav_vertices_ptr[i].z, line)) {
+			tile_line_vertices[1][line].push_back(i);
+		}
+	}
+
+	struct EdgeSplit {
+		float weight = 0.0;
+		int index = -1;
+
+		bool operator<(const EdgeSplit &p_other) const { return weight < p_other.weight; }
+	};
+	LocalVector<EdgeSplit> edge_splits;
+
+	for (Vector<int> &nav_polygon : nav_polygons) {
+		Vector<int> repaired_polygon;
+		bool repaired = false;
+
+		for (int i = 0; i < nav_polygon.size(); i++) {
+			const int index_a = nav_polygon[i];
+			const int index_b = nav_polygon[(i + 1) % nav_polygon.size()];
+			const Vector3 &vertex_a = nav_vertices_ptr[index_a];
+			const Vector3 &vertex_b = nav_vertices_ptr[index_b];
+			repaired_polygon.push_back(index_a);
+
+			for (int axis = 0; axis < 2; axis++) {
+				const Vector3::Axis line_axis = axis == 0 ? Vector3::AXIS_X : Vector3::AXIS_Z;
+				const Vector3::Axis edge_axis = axis == 0 ? Vector3::AXIS_Z : Vector3::AXIS_X;
+
+				int line_a, line_b;
+				if (!get_tile_line(vertex_a[line_axis], line_a) || !get_tile_line(vertex_b[line_axis], line_b) || line_a != line_b) {
+					continue;
+				}
+				const real_t edge_length = vertex_b[edge_axis] - vertex_a[edge_axis];
+				if (Math::abs(edge_length) < weld_size_xz) {
+					continue;
+				}
+
+				edge_splits.clear();
+				for (int index_c : tile_line_vertices[axis][line_a]) {
+					if (index_c == index_a || index_c == index_b) {
+						continue;
+					}
+					const Vector3 &vertex_c = nav_vertices_ptr[index_c];
+					const real_t weight = (vertex_c[edge_axis] - vertex_a[edge_axis]) / edge_length;
+					if (weight * Math::abs(edge_length) < weld_size_xz || (1.0 - weight) * Math::abs(edge_length) < weld_size_xz) {
+						continue;
+					}
+					if (Math::abs(Math::lerp(vertex_a.y, vertex_b.y, weight) - vertex_c.y) > ch) {
+						continue;
+					}
+					edge_splits.push_back({ (float)weight, index_c });
+				}
+
+				if (!edge_splits.is_empty()) {
+					edge_splits.sort();
+					for (const EdgeSplit &edge_split : edge_splits) {
+						repaired_polygon.push_back(edge_split.index);
+					}
+					repaired = true;
+				}
+				break;
+			}
+		}
+
+		if (repaired) {
+			nav_polygon = repaired_polygon;
+		}
+	}
+
+	navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+
+	tile_cache.tiles = std::move(baked_tiles);
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		tile_caches[navigation_mesh_id] = std::move(tile_cache);
+	}
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
 }
 
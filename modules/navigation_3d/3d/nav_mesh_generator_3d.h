@@ -32,11 +32,13 @@
 
 #include "core/object/object.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/safe_refcount.h"
+#include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 #include "servers/navigation_3d/navigation_server_3d.h"
 
 class Node;
 class NavigationMesh;
-class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	GDSOFTCLASS(NavMeshGenerator3D, Object);
@@ -96,9 +98,32 @@ private:
 
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
+	struct NavMeshGeneratorTile3D {
+		uint32_t hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct NavMeshGeneratorTileCache3D {
+		uint32_t settings_hash = 0;
+		HashMap<Vector2i, NavMeshGeneratorTile3D> tiles;
+	};
+
+	struct NavMeshGeneratorTileBakeTask3D;
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshGeneratorTileCache3D> tile_caches;
+#ifdef TESTS_ENABLED
+	static SafeNumeric<uint64_t> baked_tile_count;
+#endif // TESTS_ENABLED
+
+	static void generator_thread_bake_tile(void *p_arg);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static void generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task, const rcConfig &p_cfg, const Vector<float> &p_vertices, const Vector<int> &p_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions);
+	static bool generator_build_recast_navmesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState &r_bake_state, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -116,6 +141,9 @@ public:
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 	static String get_baking_state_msg(Ref<NavigationMesh> p_navigation_mesh);
+#ifdef TESTS_ENABLED
+	static uint64_t get_baked_tile_count();
+#endif // TESTS_ENABLED
 
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
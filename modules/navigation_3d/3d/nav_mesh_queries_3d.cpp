@@ -145,6 +145,67 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
+static uint64_t _path_query_slot_get_memory_usage(const NavMeshQueries3D::PathQuerySlot &p_path_query_slot) {
+	uint64_t memory = (uint64_t)p_path_query_slot.path_corridor.get_capacity() * sizeof(NavigationPoly);
+	memory += (uint64_t)p_path_query_slot.poly_to_id.get_capacity() * (sizeof(uint32_t) * 2 + sizeof(KeyValue<const Polygon *, uint32_t>));
+	memory += (uint64_t)p_path_query_slot.cluster_corridor.get_capacity() * sizeof(NavigationCluster);
+	return memory;
+}
+
+void NavMeshQueries3D::path_query_slot_prepare(PathQuerySlot &r_path_query_slot, const NavMapIteration3D &p_map_iteration) {
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+
+	r_path_query_slot.traversable_polys.clear();
+	r_path_query_slot.traversable_polys.reserve(polygon_count * 0.25);
+	r_path_query_slot.path_corridor.clear();
+
+	r_path_query_slot.path_corridor.resize(polygon_count);
+
+	r_path_query_slot.poly_to_id.clear();
+	r_path_query_slot.poly_to_id.reserve(polygon_count);
+
+	int polygon_id = 0;
+	for (const Ref<NavRegionIteration3D> &region : p_map_iteration.region_iterations) {
+		for (const Polygon &polygon : region->navmesh_polygons) {
+			r_path_query_slot.poly_to_id[&polygon] = polygon_id;
+			polygon_id++;
+		}
+	}
+
+	for (const Polygon &polygon : p_map_iteration.navlink_polygons) {
+		r_path_query_slot.poly_to_id[&polygon] = polygon_id;
+		polygon_id++;
+	}
+
+	DEV_ASSERT(r_path_query_slot.path_corridor.size() == r_path_query_slot.poly_to_id.size());
+
+	r_path_query_slot.traversable_clusters.clear();
+	r_path_query_slot.cluster_corridor.clear();
+	r_path_query_slot.cluster_corridor.resize(p_map_iteration.navbase_clusters.size());
+
+	r_path_query_slot.prepared = true;
+	r_path_query_slot.memory_usage.set(_path_query_slot_get_memory_usage(r_path_query_slot));
+}
+
+void NavMeshQueries3D::path_query_slot_release(PathQuerySlot &r_path_query_slot) {
+	r_path_query_slot.traversable_polys.clear();
+	r_path_query_slot.traversable_clusters.clear();
+
+	if (r_path_query_slot.prepared) {
+		// Queries used the slot in the last map iteration, keep the buffers for the next one that prepares it.
+		r_path_query_slot.path_corridor.clear();
+		r_path_query_slot.poly_to_id.clear();
+		r_path_query_slot.cluster_corridor.clear();
+	} else {
+		r_path_query_slot.path_corridor.reset();
+		r_path_query_slot.poly_to_id.reset();
+		r_path_query_slot.cluster_corridor.reset();
+		r_path_query_slot.memory_usage.set(0);
+	}
+
+	r_path_query_slot.prepared = false;
+}
+
 void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
 	ERR_FAIL_NULL(map);
 	ERR_FAIL_COND(p_query_parameters.is_null());
@@ -185,6 +246,9 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
 			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
+		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR: {
+			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR;
+		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
 			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
@@ -316,7 +380,89 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
-void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<NavBaseCluster> &navbase_clusters = p_map_iteration.navbase_clusters;
+	const AHashMap<const NavBaseIteration3D *, uint32_t> &navbase_to_cluster = p_map_iteration.navbase_to_cluster;
+
+	const uint32_t *begin_cluster_index = navbase_to_cluster.getptr(p_query_task.begin_polygon->owner);
+	const uint32_t *end_cluster_index = navbase_to_cluster.getptr(p_query_task.end_polygon->owner);
+	if (begin_cluster_index == nullptr || end_cluster_index == nullptr || *begin_cluster_index == *end_cluster_index) {
+		// Nothing to gain from the abstract graph when the path stays inside a single cluster.
+		return false;
+	}
+
+	const Vector3 end_point = p_query_task.end_position;
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>
+			&traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	ERR_FAIL_COND_V(navigation_clusters.size() != navbase_clusters.size(), false);
+	for (NavigationCluster &cluster : navigation_clusters) {
+		cluster.reset();
+	}
+
+	navigation_clusters[*begin_cluster_index].entry = p_query_task.begin_position;
+	navigation_clusters[*begin_cluster_index].traveled_distance = 0.0;
+
+	// A* over the region and link clusters, moving from portal to portal.
+	uint32_t least_cost_id = *begin_cluster_index;
+	bool found_route = false;
+
+	while (true) {
+		const NavigationCluster &least_cost_cluster = navigation_clusters[least_cost_id];
+		const real_t cluster_travel_cost = navbase_clusters[least_cost_id].navbase->get_travel_cost();
+
+		for (const ClusterPortal &portal : navbase_clusters[least_cost_id].portals) {
+			const NavBaseIteration3D *neighbor_navbase = navbase_clusters[portal.cluster].navbase;
+			if (!_query_task_is_connection_owner_usable(p_query_task, neighbor_navbase)) {
+				continue;
+			}
+
+			const real_t new_traveled_distance = least_cost_cluster.traveled_distance + least_cost_cluster.entry.distance_to(portal.position) * cluster_travel_cost + neighbor_navbase->get_enter_cost();
+
+			NavigationCluster &neighbor_cluster = navigation_clusters[portal.cluster];
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_navigation_cluster_id = least_cost_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				neighbor_cluster.distance_to_destination = portal.position.distance_to(end_point) * neighbor_navbase->get_travel_cost();
+				neighbor_cluster.entry = portal.position;
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+
+		if (traversable_clusters.is_empty()) {
+			break;
+		}
+
+		least_cost_id = traversable_clusters.pop() - navigation_clusters.ptr();
+		if (least_cost_id == *end_cluster_index) {
+			found_route = true;
+			break;
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	// Mark the clusters on the abstract path, the polygon search is only allowed to enter those.
+	int cluster_id = least_cost_id;
+	while (cluster_id != -1) {
+		navigation_clusters[cluster_id].in_corridor = true;
+		cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id;
+	}
+
+	return true;
+}
+
+bool NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, bool p_use_cluster_corridor) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -351,6 +497,8 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	real_t poly_enter_cost = 0.0;
 
 	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Nav3D::Connection>>> &navbases_polygons_external_connections = p_map_iteration.navbases_polygons_external_connections;
+	const AHashMap<const NavBaseIteration3D *, uint32_t> &navbase_to_cluster = p_map_iteration.navbase_to_cluster;
+	const LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
 
 	// True if we reached the max polygon search count or distance from the begin position.
 	bool path_search_max_reached = false;
@@ -383,6 +531,12 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 
 		// Search region external navmesh polygon connections, aka connections to other regions created by outline edge merge or links.
 		for (const Connection &connection : navbases_polygons_external_connections[least_cost_navbase][navbase_local_polygon_id]) {
+			if (p_use_cluster_corridor) {
+				const uint32_t *cluster_index = navbase_to_cluster.getptr(connection.polygon->owner);
+				if (cluster_index == nullptr || !navigation_clusters[*cluster_index].in_corridor) {
+					continue;
+				}
+			}
 			_query_task_search_polygon_connections(p_query_task, connection, least_cost_id, least_cost_poly, poly_enter_cost, end_point);
 		}
 
@@ -400,6 +554,11 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_use_cluster_corridor) {
+				// The abstract path is blocked on the polygon level, let the caller run the full search.
+				return false;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "Invalid navigation index or connection pointers. Check preceding navmesh geometry or placement errors.");
 			is_reachable = false;
@@ -443,7 +602,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				_query_task_push_back_point_with_metadata(p_query_task, begin_point, begin_poly);
 				_query_task_push_back_point_with_metadata(p_query_task, end_point, begin_poly);
 				p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED;
-				return;
+				return true;
 			}
 
 			for (NavigationPoly &nav_poly : navigation_polys) {
@@ -475,7 +634,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 			}
 
 			if (navigation_polys[least_cost_id].poly->owner->get_self() != least_cost_poly.poly->owner->get_self()) {
-				ERR_FAIL_NULL(least_cost_poly.poly->owner);
+				ERR_FAIL_NULL_V(least_cost_poly.poly->owner, true);
 				poly_enter_cost = least_cost_poly.poly->owner->get_enter_cost();
 			}
 		}
@@ -509,6 +668,8 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		p_query_task.begin_polygon = begin_poly;
 		p_query_task.least_cost_id = least_cost_id;
 	}
+
+	return true;
 }
 
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
@@ -530,7 +691,37 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task, p_map_iteration);
+	// Region filters and a search distance limit make the corridor depend on more than the polygons, those queries always search.
+	const bool use_path_corridor_cache = p_map_iteration.path_corridor_cache.get_capacity() > 0 && !p_query_task.exclude_regions && !p_query_task.include_regions && p_query_task.path_search_max_distance <= 0.0;
+
+	PathCorridorKey path_corridor_key;
+	path_corridor_key.begin_polygon = p_query_task.begin_polygon;
+	path_corridor_key.end_polygon = p_query_task.end_polygon;
+	path_corridor_key.navigation_layers = p_query_task.navigation_layers;
+	path_corridor_key.pathfinding_algorithm = p_query_task.pathfinding_algorithm;
+	path_corridor_key.path_search_max_polygons = p_query_task.path_search_max_polygons;
+
+	if (use_path_corridor_cache && _query_task_load_cached_path_corridor(p_query_task, p_map_iteration, path_corridor_key)) {
+		p_query_task.path_corridor_cache_status = NavMeshPathQueryTask3D::PATH_CORRIDOR_CACHE_HIT;
+	} else {
+		bool path_corridor_built = false;
+		if (p_query_task.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR && _query_task_build_cluster_corridor(p_query_task, p_map_iteration)) {
+			// Refine the abstract path on the polygons of its clusters only.
+			path_corridor_built = _query_task_build_path_corridor(p_query_task, p_map_iteration, true);
+		}
+		if (!path_corridor_built) {
+			_query_task_build_path_corridor(p_query_task, p_map_iteration);
+		}
+
+		if (use_path_corridor_cache) {
+			p_query_task.path_corridor_cache_status = NavMeshPathQueryTask3D::PATH_CORRIDOR_CACHE_MISS;
+
+			// Only corridors that reach the end polygon are worth reusing, the others depend on the exact target position.
+			if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED && p_query_task.end_polygon == path_corridor_key.end_polygon) {
+				_query_task_cache_path_corridor(p_query_task, p_map_iteration, path_corridor_key);
+			}
+		}
+	}
 
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
@@ -732,6 +923,53 @@ void NavMeshQueries3D::_query_task_simplified_path_points(NavMeshPathQueryTask3D
 	}
 }
 
+bool NavMeshQueries3D::_query_task_load_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCorridorKey &p_key) {
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+	AHashMap<const Polygon *, uint32_t> &poly_to_id = p_query_task.path_query_slot->poly_to_id;
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+
+	const PathCorridor *path_corridor = p_map_iteration.path_corridor_cache.getptr(p_key);
+	if (path_corridor == nullptr) {
+		return false;
+	}
+
+	// Only the polygons along the corridor are used by the post-processing, so only those are restored.
+	// The entry positions are recalculated from the begin position of this query like the search does.
+	int back_navigation_poly_id = -1;
+	Vector3 entry = p_query_task.begin_position;
+	for (const NavigationPoly &corridor_poly : path_corridor->polygons) {
+		const uint32_t navigation_poly_id = poly_to_id[corridor_poly.poly];
+		NavigationPoly &navigation_poly = navigation_polys[navigation_poly_id];
+		navigation_poly = corridor_poly;
+		navigation_poly.back_navigation_poly_id = back_navigation_poly_id;
+		if (back_navigation_poly_id == -1) {
+			navigation_poly.back_navigation_edge_pathway_start = entry;
+			navigation_poly.back_navigation_edge_pathway_end = entry;
+		} else {
+			entry = Geometry3D::get_closest_point_to_segment(entry, navigation_poly.back_navigation_edge_pathway_start, navigation_poly.back_navigation_edge_pathway_end);
+		}
+		navigation_poly.entry = entry;
+		back_navigation_poly_id = navigation_poly_id;
+	}
+
+	p_query_task.least_cost_id = back_navigation_poly_id;
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCorridorKey &p_key) {
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	PathCorridor path_corridor;
+	for (int navigation_poly_id = p_query_task.least_cost_id; navigation_poly_id != -1; navigation_poly_id = navigation_polys[navigation_poly_id].back_navigation_poly_id) {
+		path_corridor.polygons.push_back(navigation_polys[navigation_poly_id]);
+	}
+	path_corridor.polygons.reverse();
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+	p_map_iteration.path_corridor_cache.insert(p_key, path_corridor);
+}
+
 void NavMeshQueries3D::_query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task) {
 	Vector3 end_point = p_query_task.end_position;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -1094,6 +1332,370 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 	}
 }
 
+Vector3 NavMeshQueries3D::map_iteration_get_flow_direction(const NavMapIteration3D &p_map_iteration, const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers) {
+	NavMeshPathQueryTask3D query_task;
+	query_task.navigation_layers = p_navigation_layers;
+
+	if (!p_map_iteration.flow_field_polygon_grid.built.is_set()) {
+		MutexLock lock(p_map_iteration.flow_fields_mutex);
+		if (!p_map_iteration.flow_field_polygon_grid.built.is_set()) {
+			_map_iteration_build_polygon_grid(p_map_iteration, p_map_iteration.flow_field_polygon_grid);
+			p_map_iteration.flow_field_polygon_grid.built.set();
+		}
+	}
+
+	Vector3 position_on_polygon;
+	const Polygon *position_polygon = _query_task_get_closest_polygon(query_task, p_map_iteration, p_position, position_on_polygon);
+	if (position_polygon == nullptr) {
+		return Vector3();
+	}
+
+	const uint32_t *cluster_index = p_map_iteration.navbase_to_cluster.getptr(position_polygon->owner);
+	ERR_FAIL_NULL_V(cluster_index, Vector3());
+	const uint32_t polygon_index = p_map_iteration.navbase_clusters[*cluster_index].polygon_offset + position_polygon->id;
+
+	FlowFieldKey flow_field_key;
+	flow_field_key.target_position = p_target_position;
+	flow_field_key.navigation_layers = p_navigation_layers;
+
+	// Only the lookup happens under the cache mutex, the field itself is built outside of it.
+	FlowField *flow_field = nullptr;
+	bool build_flow_field = false;
+	{
+		MutexLock lock(p_map_iteration.flow_fields_mutex);
+
+		FlowField **flow_field_ptr = p_map_iteration.flow_fields.getptr(flow_field_key);
+		if (flow_field_ptr) {
+			flow_field = *flow_field_ptr;
+			flow_field->refcount.ref();
+		} else {
+			if (p_map_iteration.flow_fields.size() >= (uint32_t)NavigationDefaults3D::flow_field_cache_max) {
+				for (const KeyValue<FlowFieldKey, FlowField *> &E : p_map_iteration.flow_fields) {
+					if (E.value->refcount.unref()) {
+						memdelete(E.value);
+					}
+				}
+				p_map_iteration.flow_fields.clear();
+			}
+
+			flow_field = memnew(FlowField);
+			flow_field->refcount.init(2); // One for the cache, one for this query.
+			flow_field->build_mutex.lock();
+			p_map_iteration.flow_fields.insert(flow_field_key, flow_field);
+			build_flow_field = true;
+		}
+	}
+
+	if (build_flow_field) {
+		Vector3 target_on_polygon;
+		const Polygon *target_polygon = _query_task_get_closest_polygon(query_task, p_map_iteration, p_target_position, target_on_polygon);
+		if (target_polygon != nullptr) {
+			flow_field->target_position = target_on_polygon;
+			_query_task_build_flow_field(query_task, p_map_iteration, target_polygon, *flow_field);
+		}
+		flow_field->built.set();
+		flow_field->build_mutex.unlock();
+	} else if (!flow_field->built.is_set()) {
+		// Another query is building this field, wait for it.
+		MutexLock build_lock(flow_field->build_mutex);
+	}
+
+	Vector3 direction;
+	if (polygon_index < flow_field->polygons.size()) {
+		const FlowFieldPolygon &flow_field_polygon = flow_field->polygons[polygon_index];
+		if (flow_field_polygon.travel_cost == FLT_MAX) {
+			// The target can not be reached from here.
+		} else if (polygon_index == flow_field->target_polygon_index) {
+			direction = (flow_field->target_position - position_on_polygon).normalized();
+		} else {
+			const Vector3 pathway_point = Geometry3D::get_closest_point_to_segment(position_on_polygon, flow_field_polygon.pathway_start, flow_field_polygon.pathway_end);
+			direction = (pathway_point - position_on_polygon).normalized();
+		}
+	}
+
+	if (flow_field->refcount.unref()) {
+		memdelete(flow_field);
+	}
+
+	return direction;
+}
+
+void NavMeshQueries3D::_map_iteration_build_polygon_grid(const NavMapIteration3D &p_map_iteration, PolygonGrid &r_grid) {
+	// Keep the grid at about one cell per polygon, but never larger than this on either axis.
+	const int32_t grid_size_max = 1024;
+
+	r_grid.width = 0;
+	r_grid.depth = 0;
+	r_grid.cell_offsets.clear();
+	r_grid.cell_polygons.clear();
+
+	uint32_t polygon_count = 0;
+	Vector2 bounds_min(FLT_MAX, FLT_MAX);
+	Vector2 bounds_max(-FLT_MAX, -FLT_MAX);
+	for (const Ref<NavRegionIteration3D> &region : p_map_iteration.region_iterations) {
+		for (const Polygon &polygon : region->get_navmesh_polygons()) {
+			for (const Vector3 &vertex : polygon.vertices) {
+				bounds_min = bounds_min.min(Vector2(vertex.x, vertex.z));
+				bounds_max = bounds_max.max(Vector2(vertex.x, vertex.z));
+			}
+			polygon_count++;
+		}
+	}
+	if (polygon_count == 0) {
+		return;
+	}
+
+	const Vector2 size = bounds_max - bounds_min;
+	r_grid.cell_size = MAX(Math::sqrt(MAX(size.x * size.y, (real_t)CMP_EPSILON) / polygon_count), MAX(size.x, size.y) / grid_size_max);
+	r_grid.cell_size = MAX(r_grid.cell_size, (real_t)CMP_EPSILON);
+	r_grid.origin = Vector3(bounds_min.x, 0.0, bounds_min.y);
+	r_grid.width = CLAMP((int32_t)Math::floor(size.x / r_grid.cell_size) + 1, 1, grid_size_max);
+	r_grid.depth = CLAMP((int32_t)Math::floor(size.y / r_grid.cell_size) + 1, 1, grid_size_max);
+
+	r_grid.cell_offsets.resize(r_grid.width * r_grid.depth + 1);
+	for (uint32_t &offset : r_grid.cell_offsets) {
+		offset = 0;
+	}
+
+	// Count the polygons of every cell first, then fill them in.
+	for (int pass = 0; pass < 2; pass++) {
+		for (const Ref<NavRegionIteration3D> &region : p_map_iteration.region_iterations) {
+			for (const Polygon &polygon : region->get_navmesh_polygons()) {
+				Vector2 polygon_min(FLT_MAX, FLT_MAX);
+				Vector2 polygon_max(-FLT_MAX, -FLT_MAX);
+				for (const Vector3 &vertex : polygon.vertices) {
+					polygon_min = polygon_min.min(Vector2(vertex.x, vertex.z));
+					polygon_max = polygon_max.max(Vector2(vertex.x, vertex.z));
+				}
+				const int32_t x_from = CLAMP((int32_t)((polygon_min.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.width - 1);
+				const int32_t x_to = CLAMP((int32_t)((polygon_max.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.width - 1);
+				const int32_t z_from = CLAMP((int32_t)((polygon_min.y - r_grid.origin.z) / r_grid.cell_size), 0, r_grid.depth - 1);
+				const int32_t z_to = CLAMP((int32_t)((polygon_max.y - r_grid.origin.z) / r_grid.cell_size), 0, r_grid.depth - 1);
+
+				for (int32_t z = z_from; z <= z_to; z++) {
+					for (int32_t x = x_from; x <= x_to; x++) {
+						const uint32_t cell_index = z * r_grid.width + x;
+						if (pass == 0) {
+							r_grid.cell_offsets[cell_index + 1]++;
+						} else {
+							r_grid.cell_polygons[r_grid.cell_offsets[cell_index]++] = &polygon;
+						}
+					}
+				}
+			}
+		}
+
+		const uint32_t cell_count = r_grid.width * r_grid.depth;
+		if (pass == 0) {
+			for (uint32_t i = 1; i <= cell_count; i++) {
+				r_grid.cell_offsets[i] += r_grid.cell_offsets[i - 1];
+			}
+			r_grid.cell_polygons.resize(r_grid.cell_offsets[cell_count]);
+		} else {
+			// Filling advanced every offset to the start of the next cell, shift them back.
+			for (uint32_t i = cell_count; i > 0; i--) {
+				r_grid.cell_offsets[i] = r_grid.cell_offsets[i - 1];
+			}
+			r_grid.cell_offsets[0] = 0;
+		}
+	}
+}
+
+const Polygon *NavMeshQueries3D::_query_task_get_closest_polygon(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Vector3 &p_point, Vector3 &r_closest_point) {
+	const PolygonGrid &grid = p_map_iteration.flow_field_polygon_grid;
+	DEV_ASSERT(grid.built.is_set());
+	if (grid.width == 0 || grid.depth == 0) {
+		return nullptr;
+	}
+
+	const Polygon *closest_polygon = nullptr;
+	real_t closest_distance = FLT_MAX;
+
+	const int32_t center_x = CLAMP((int32_t)Math::floor((p_point.x - grid.origin.x) / grid.cell_size), 0, grid.width - 1);
+	const int32_t center_z = CLAMP((int32_t)Math::floor((p_point.z - grid.origin.z) / grid.cell_size), 0, grid.depth - 1);
+	const int32_t ring_max = MAX(grid.width, grid.depth);
+
+	// Search rings of cells around the point, until the next ring is farther away than the closest polygon found so far.
+	for (int32_t ring = 0; ring < ring_max; ring++) {
+		if (closest_polygon != nullptr && ring > 0) {
+			const real_t ring_distance = (ring - 1) * grid.cell_size;
+			if (ring_distance * ring_distance >= closest_distance) {
+				break;
+			}
+		}
+
+		for (int32_t z = center_z - ring; z <= center_z + ring; z++) {
+			if (z < 0 || z >= grid.depth) {
+				continue;
+			}
+			const bool full_row = z == center_z - ring || z == center_z + ring;
+			const int32_t x_step = full_row ? 1 : MAX(ring * 2, 1);
+			for (int32_t x = center_x - ring; x <= center_x + ring; x += x_step) {
+				if (x < 0 || x >= grid.width) {
+					continue;
+				}
+
+				const uint32_t cell_index = z * grid.width + x;
+				for (uint32_t i = grid.cell_offsets[cell_index]; i < grid.cell_offsets[cell_index + 1]; i++) {
+					const Polygon *polygon = grid.cell_polygons[i];
+					if (!_query_task_is_connection_owner_usable(p_query_task, polygon->owner)) {
+						continue;
+					}
+
+					for (uint32_t point_id = 2; point_id < polygon->vertices.size(); point_id++) {
+						const Face3 face(polygon->vertices[0], polygon->vertices[point_id - 1], polygon->vertices[point_id]);
+						const Vector3 point = face.get_closest_point_to(p_point);
+						const real_t distance = point.distance_squared_to(p_point);
+						if (distance < closest_distance) {
+							closest_distance = distance;
+							closest_polygon = polygon;
+							r_closest_point = point;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return closest_polygon;
+}
+
+void NavMeshQueries3D::_query_task_build_flow_field(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Polygon *p_target_polygon, FlowField &r_flow_field) {
+	const LocalVector<NavBaseCluster> &navbase_clusters = p_map_iteration.navbase_clusters;
+	const AHashMap<const NavBaseIteration3D *, uint32_t> &navbase_to_cluster = p_map_iteration.navbase_to_cluster;
+	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &navbases_polygons_external_connections = p_map_iteration.navbases_polygons_external_connections;
+	const uint32_t region_count = p_map_iteration.region_iterations.size();
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+
+	// Number all polygons of the map in cluster order.
+	LocalVector<const Polygon *> polygons;
+	polygons.resize(polygon_count);
+	for (uint32_t cluster_index = 0; cluster_index < navbase_clusters.size(); cluster_index++) {
+		const NavBaseCluster &cluster = navbase_clusters[cluster_index];
+		if (cluster_index < region_count) {
+			for (const Polygon &polygon : cluster.navbase->get_navmesh_polygons()) {
+				polygons[cluster.polygon_offset + polygon.id] = &polygon;
+			}
+		} else {
+			polygons[cluster.polygon_offset] = &p_map_iteration.navlink_polygons[cluster_index - region_count];
+		}
+	}
+
+	struct IncomingConnection {
+		uint32_t polygon_index = 0;
+		const Connection *connection = nullptr;
+	};
+
+	// The field is integrated backwards from the target, so every polygon needs the connections that lead into it.
+	LocalVector<uint32_t> incoming_offsets;
+	incoming_offsets.resize(polygon_count + 1);
+	for (uint32_t &offset : incoming_offsets) {
+		offset = 0;
+	}
+	LocalVector<IncomingConnection> incoming_connections;
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint32_t polygon_index = 0; polygon_index < polygon_count; polygon_index++) {
+			const Polygon *polygon = polygons[polygon_index];
+			if (polygon == nullptr) {
+				continue;
+			}
+			const LocalVector<LocalVector<Connection>> &internal_connections = polygon->owner->get_internal_connections();
+			const LocalVector<LocalVector<Connection>> *external_connections = navbases_polygons_external_connections.getptr(polygon->owner);
+
+			const LocalVector<Connection> *polygon_connections[2] = {
+				polygon->id < internal_connections.size() ? &internal_connections[polygon->id] : nullptr,
+				external_connections && polygon->id < external_connections->size() ? &(*external_connections)[polygon->id] : nullptr,
+			};
+
+			for (const LocalVector<Connection> *connections : polygon_connections) {
+				if (connections == nullptr) {
+					continue;
+				}
+				for (const Connection &connection : *connections) {
+					const uint32_t *target_cluster_index = navbase_to_cluster.getptr(connection.polygon->owner);
+					if (target_cluster_index == nullptr) {
+						continue;
+					}
+					const uint32_t target_polygon_index = navbase_clusters[*target_cluster_index].polygon_offset + connection.polygon->id;
+					if (pass == 0) {
+						incoming_offsets[target_polygon_index + 1]++;
+					} else {
+						IncomingConnection &incoming = incoming_connections[incoming_offsets[target_polygon_index]++];
+						incoming.polygon_index = polygon_index;
+						incoming.connection = &connection;
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t i = 1; i <= polygon_count; i++) {
+				incoming_offsets[i] += incoming_offsets[i - 1];
+			}
+			incoming_connections.resize(incoming_offsets[polygon_count]);
+		} else {
+			// Filling advanced every offset to the start of the next polygon, shift them back.
+			for (uint32_t i = polygon_count; i > 0; i--) {
+				incoming_offsets[i] = incoming_offsets[i - 1];
+			}
+			incoming_offsets[0] = 0;
+		}
+	}
+
+	LocalVector<FlowFieldPolygon> &field_polygons = r_flow_field.polygons;
+	field_polygons.resize(polygon_count);
+
+	const uint32_t *target_cluster_index = navbase_to_cluster.getptr(p_target_polygon->owner);
+	ERR_FAIL_NULL(target_cluster_index);
+	r_flow_field.target_polygon_index = navbase_clusters[*target_cluster_index].polygon_offset + p_target_polygon->id;
+
+	FlowFieldPolygon &target_field_polygon = field_polygons[r_flow_field.target_polygon_index];
+	target_field_polygon.travel_cost = 0.0;
+	target_field_polygon.entry = r_flow_field.target_position;
+	target_field_polygon.pathway_start = r_flow_field.target_position;
+	target_field_polygon.pathway_end = r_flow_field.target_position;
+
+	Heap<FlowFieldPolygon *, FlowFieldPolygonCostGreaterThan, FlowFieldPolygonHeapIndexer> traversable_polys;
+	traversable_polys.push(&target_field_polygon);
+
+	// Dijkstra from the target over the reversed connections.
+	while (!traversable_polys.is_empty()) {
+		const FlowFieldPolygon *least_cost_poly = traversable_polys.pop();
+		const uint32_t least_cost_id = least_cost_poly - field_polygons.ptr();
+		const NavBaseIteration3D *least_cost_navbase = polygons[least_cost_id]->owner;
+		const real_t poly_travel_cost = least_cost_navbase->get_travel_cost();
+
+		for (uint32_t i = incoming_offsets[least_cost_id]; i < incoming_offsets[least_cost_id + 1]; i++) {
+			const IncomingConnection &incoming = incoming_connections[i];
+			const NavBaseIteration3D *source_navbase = polygons[incoming.polygon_index]->owner;
+			if (!_query_task_is_connection_owner_usable(p_query_task, source_navbase)) {
+				continue;
+			}
+
+			const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly->entry, incoming.connection->pathway_start, incoming.connection->pathway_end);
+			real_t new_travel_cost = least_cost_poly->travel_cost + least_cost_poly->entry.distance_to(new_entry) * poly_travel_cost;
+			if (source_navbase != least_cost_navbase) {
+				new_travel_cost += least_cost_navbase->get_enter_cost();
+			}
+
+			FlowFieldPolygon &source_poly = field_polygons[incoming.polygon_index];
+			if (new_travel_cost < source_poly.travel_cost) {
+				source_poly.travel_cost = new_travel_cost;
+				source_poly.entry = new_entry;
+				source_poly.pathway_start = incoming.connection->pathway_start;
+				source_poly.pathway_end = incoming.connection->pathway_end;
+
+				if (source_poly.traversable_poly_index != traversable_polys.INVALID_INDEX) {
+					traversable_polys.shift(source_poly.traversable_poly_index);
+				} else {
+					traversable_polys.push(&source_poly);
+				}
+			}
+		}
+	}
+}
+
 Vector3 NavMeshQueries3D::polygons_get_closest_point_to_segment(const LocalVector<Polygon> &p_polygons, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) {
 	bool use_collision = p_use_collision;
 	Vector3 closest_point;
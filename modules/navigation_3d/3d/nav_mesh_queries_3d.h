@@ -50,8 +50,14 @@ public:
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
 		bool in_use = false;
+		// Set up for the map iteration on first use, slots that no query needs keep no per-polygon data.
+		bool prepared = false;
+		// Bytes held by the per-polygon data. Written by the query that prepares the slot, so memory reports can read it at any time.
+		SafeNumeric<uint64_t> memory_usage;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
+		LocalVector<Nav3D::NavigationCluster> cluster_corridor;
+		Heap<Nav3D::NavigationCluster *, Nav3D::NavClusterTravelCostGreaterThan, Nav3D::NavClusterHeapIndexer> traversable_clusters;
 	};
 
 	struct NavMeshPathQueryTask3D {
@@ -63,6 +69,12 @@ public:
 			CALLBACK_FAILED,
 		};
 
+		enum PathCorridorCacheStatus {
+			PATH_CORRIDOR_CACHE_UNUSED,
+			PATH_CORRIDOR_CACHE_HIT,
+			PATH_CORRIDOR_CACHE_MISS,
+		};
+
 		// Parameters.
 		Vector3 start_position;
 		Vector3 target_position;
@@ -89,6 +101,7 @@ public:
 		const Nav3D::Polygon *begin_polygon = nullptr;
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		PathCorridorCacheStatus path_corridor_cache_status = PATH_CORRIDOR_CACHE_UNUSED;
 
 		// Map.
 		Vector3 map_up;
@@ -138,13 +151,20 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Nav3D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static Vector3 map_iteration_get_flow_direction(const NavMapIteration3D &p_map_iteration, const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers);
+
+	static void path_query_slot_prepare(PathQuerySlot &r_path_query_slot, const NavMapIteration3D &p_map_iteration);
+	static void path_query_slot_release(PathQuerySlot &r_path_query_slot);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
-	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, bool p_use_cluster_corridor = false);
+	static bool _query_task_load_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCorridorKey &p_key);
+	static void _query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCorridorKey &p_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
@@ -153,6 +173,10 @@ public:
 	static bool _query_task_is_connection_owner_usable(const NavMeshPathQueryTask3D &p_query_task, const NavBaseIteration3D *p_owner);
 	static void _query_task_process_path_result_limits(NavMeshPathQueryTask3D &p_query_task);
 
+	static void _map_iteration_build_polygon_grid(const NavMapIteration3D &p_map_iteration, Nav3D::PolygonGrid &r_grid);
+	static const Nav3D::Polygon *_query_task_get_closest_polygon(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Vector3 &p_point, Vector3 &r_closest_point);
+	static void _query_task_build_flow_field(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::Polygon *p_target_polygon, Nav3D::FlowField &r_flow_field);
+
 	static void _query_task_search_polygon_connections(NavMeshPathQueryTask3D &p_query_task, const Nav3D::Connection &p_connection, uint32_t p_least_cost_id, const Nav3D::NavigationPoly &p_least_cost_poly, real_t p_poly_enter_cost, const Vector3 &p_end_point);
 
 	static void simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, LocalVector<uint32_t> &r_simplified_path_indices);
@@ -80,6 +80,8 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 
 	bool first_vertex = true;
 
+	uint32_t geometry_hash = hash_murmur3_one_32(navmesh_polygons.size());
+
 	for (uint32_t i = 0; i < navmesh_polygons.size(); i++) {
 		Polygon &polygon = navmesh_polygons[i];
 		polygon.id = i;
@@ -125,6 +127,10 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 			const Vector3 point_position = region_transform.xform(vertices_ptr[vertex_index]);
 			polygon.vertices[j] = point_position;
 
+			geometry_hash = hash_murmur3_one_real(point_position.x, geometry_hash);
+			geometry_hash = hash_murmur3_one_real(point_position.y, geometry_hash);
+			geometry_hash = hash_murmur3_one_real(point_position.z, geometry_hash);
+
 			if (first_vertex) {
 				first_vertex = false;
 				_new_region_bounds.position = point_position;
@@ -142,6 +148,7 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 
 	region_iteration->surface_area = _new_region_surface_area;
 	region_iteration->bounds = _new_region_bounds;
+	region_iteration->geometry_hash = hash_fmix32(geometry_hash);
 
 	performance_data.pm_polygon_count = navmesh_polygons.size();
 }
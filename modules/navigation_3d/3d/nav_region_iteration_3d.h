@@ -77,6 +77,8 @@ public:
 	real_t surface_area = 0.0;
 	AABB bounds;
 	LocalVector<Nav3D::ConnectableEdge> external_edges;
+	// Hash of the polygon vertices in map space, used to validate stored map connection data.
+	uint32_t geometry_hash = 0;
 
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
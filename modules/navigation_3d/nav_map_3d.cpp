@@ -168,10 +168,20 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
 	}
 
+	if (!p_query_task.path_query_slot->prepared) {
+		NavMeshQueries3D::path_query_slot_prepare(*p_query_task.path_query_slot, map_iteration);
+	}
+
 	p_query_task.map_up = map_iteration.map_up;
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
+	if (p_query_task.path_corridor_cache_status == NavMeshQueries3D::NavMeshPathQueryTask3D::PATH_CORRIDOR_CACHE_HIT) {
+		path_corridor_cache_hits.increment();
+	} else if (p_query_task.path_corridor_cache_status == NavMeshQueries3D::NavMeshPathQueryTask3D::PATH_CORRIDOR_CACHE_MISS) {
+		path_corridor_cache_misses.increment();
+	}
+
 	map_iteration.path_query_slots_mutex.lock();
 	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
 	map_iteration.path_query_slots[used_slot_index].in_use = false;
@@ -225,6 +235,17 @@ RID NavMap3D::get_closest_point_owner(const Vector3 &p_point) const {
 	return NavMeshQueries3D::map_iteration_get_closest_point_owner(map_iteration, p_point);
 }
 
+Vector3 NavMap3D::get_flow_direction(const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers) const {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		return Vector3();
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	return NavMeshQueries3D::map_iteration_get_flow_direction(map_iteration, p_position, p_target_position, p_navigation_layers);
+}
+
 ClosestPointQueryResult NavMap3D::get_closest_point_info(const Vector3 &p_point) const {
 	GET_MAP_ITERATION_CONST();
 
@@ -335,6 +356,134 @@ Vector3 NavMap3D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries3D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+void NavMap3D::set_connection_data(const Vector<uint8_t> &p_data) {
+	connection_data = p_data;
+	iteration_dirty = true;
+}
+
+Vector<uint8_t> NavMap3D::get_connection_data() const {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		return Vector<uint8_t>();
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	return NavMapBuilder3D::get_connection_data(map_iteration, performance_data);
+}
+
+template <typename T>
+static uint64_t _get_vector_memory(const LocalVector<T> &p_vector) {
+	return (uint64_t)p_vector.get_capacity() * sizeof(T);
+}
+
+template <typename TKey, typename TValue, typename Hasher>
+static uint64_t _get_hash_map_memory(const HashMap<TKey, TValue, Hasher> &p_map) {
+	if (p_map.is_empty()) {
+		return 0;
+	}
+	return (uint64_t)p_map.get_capacity() * (sizeof(uint32_t) + sizeof(HashMapElement<TKey, TValue> *)) + p_map.size() * sizeof(HashMapElement<TKey, TValue>);
+}
+
+template <typename TKey, typename TValue, typename Hasher>
+static uint64_t _get_hash_map_memory(const AHashMap<TKey, TValue, Hasher> &p_map) {
+	if (p_map.is_empty()) {
+		return 0;
+	}
+	return (uint64_t)p_map.get_capacity() * (sizeof(uint32_t) * 2 + sizeof(KeyValue<TKey, TValue>));
+}
+
+static uint64_t _get_polygons_memory(const LocalVector<Polygon> &p_polygons) {
+	uint64_t memory = _get_vector_memory(p_polygons);
+	for (const Polygon &polygon : p_polygons) {
+		memory += _get_vector_memory(polygon.vertices);
+	}
+	return memory;
+}
+
+static uint64_t _get_polygons_connections_memory(const LocalVector<LocalVector<Connection>> &p_polygons_connections) {
+	uint64_t memory = _get_vector_memory(p_polygons_connections);
+	for (const LocalVector<Connection> &polygon_connections : p_polygons_connections) {
+		memory += _get_vector_memory(polygon_connections);
+	}
+	return memory;
+}
+
+int64_t NavMap3D::get_memory_usage() const {
+	uint64_t memory = sizeof(NavMap3D);
+
+	memory += (uint64_t)regions.size() * sizeof(NavRegion3D) + (uint64_t)links.size() * sizeof(NavLink3D);
+	memory += (uint64_t)agents.size() * sizeof(NavAgent3D) + (uint64_t)obstacles.size() * sizeof(NavObstacle3D);
+	memory += _get_vector_memory(avoidance_grid_agents) + _get_vector_memory(rvo_agents_2d) + _get_vector_memory(rvo_agents_3d);
+
+	if (iteration_id == 0) {
+		return memory;
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	// Regions and links belong to a single map, so their polygons are counted here.
+	for (const Ref<NavRegionIteration3D> &region : map_iteration.region_iterations) {
+		memory += sizeof(NavRegionIteration3D);
+		memory += _get_polygons_memory(region->navmesh_polygons);
+		memory += _get_polygons_connections_memory(region->internal_connections);
+		memory += _get_vector_memory(region->external_edges);
+	}
+	for (const Ref<NavLinkIteration3D> &link : map_iteration.link_iterations) {
+		memory += sizeof(NavLinkIteration3D);
+		memory += _get_polygons_memory(link->navmesh_polygons);
+		memory += _get_polygons_connections_memory(link->internal_connections);
+	}
+
+	memory += _get_polygons_memory(map_iteration.navlink_polygons);
+	memory += _get_hash_map_memory(map_iteration.external_region_connections);
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<Connection>> &E : map_iteration.external_region_connections) {
+		memory += _get_vector_memory(E.value);
+	}
+	memory += _get_hash_map_memory(map_iteration.navbases_polygons_external_connections);
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &E : map_iteration.navbases_polygons_external_connections) {
+		memory += _get_polygons_connections_memory(E.value);
+	}
+
+	memory += _get_vector_memory(map_iteration.navbase_clusters);
+	for (const NavBaseCluster &navbase_cluster : map_iteration.navbase_clusters) {
+		memory += _get_vector_memory(navbase_cluster.portals);
+	}
+	memory += _get_hash_map_memory(map_iteration.navbase_to_cluster);
+	memory += _get_hash_map_memory(map_iteration.region_ptr_to_region_iteration);
+
+	{
+		MutexLock lock(map_iteration.flow_fields_mutex);
+		memory += _get_hash_map_memory(map_iteration.flow_fields);
+		for (const KeyValue<FlowFieldKey, FlowField *> &E : map_iteration.flow_fields) {
+			memory += sizeof(FlowField);
+			// Fields still being built are written outside of the mutex.
+			if (E.value->built.is_set()) {
+				memory += _get_vector_memory(E.value->polygons);
+			}
+		}
+		if (map_iteration.flow_field_polygon_grid.built.is_set()) {
+			memory += _get_vector_memory(map_iteration.flow_field_polygon_grid.cell_offsets);
+			memory += _get_vector_memory(map_iteration.flow_field_polygon_grid.cell_polygons);
+		}
+	}
+
+	{
+		MutexLock lock(map_iteration.path_corridor_cache_mutex);
+		// The cached corridors are short compared to the map, count their entries only.
+		memory += (uint64_t)map_iteration.path_corridor_cache.get_size() * (sizeof(PathCorridorKey) + sizeof(PathCorridor));
+	}
+
+	// Only the path query slots that path queries used recently hold per-polygon data.
+	// Queries prepare their slot without holding a lock, so each slot counts its own bytes.
+	for (const NavMeshQueries3D::PathQuerySlot &path_query_slot : map_iteration.path_query_slots) {
+		memory += sizeof(NavMeshQueries3D::PathQuerySlot);
+		memory += path_query_slot.memory_usage.get();
+	}
+
+	return memory;
+}
+
 void NavMap3D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -369,6 +518,7 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.connection_data = connection_data;
 
 	next_map_iteration.clear();
 
@@ -415,6 +565,15 @@ void NavMap3D::_sync_iteration() {
 
 	performance_data.pm_edge_connection_count = iteration_build.performance_data.pm_edge_connection_count;
 	performance_data.pm_edge_free_count = iteration_build.performance_data.pm_edge_free_count;
+	performance_data.pm_iteration_build_time = iteration_build.performance_data.pm_iteration_build_time;
+	performance_data.pm_connection_data_loaded = iteration_build.performance_data.pm_connection_data_loaded;
+
+	// Keep data that did not match yet, the map may still be missing regions or links that are added over the next syncs.
+	// Loaded data is no longer needed, and corrupted data would only print its error again.
+	if ((iteration_build.connection_data_loaded || iteration_build.connection_data_corrupted) && connection_data.ptr() == iteration_build.connection_data.ptr()) {
+		connection_data.clear();
+	}
+	iteration_build.connection_data.clear();
 
 	iteration_id = iteration_id % UINT32_MAX + 1;
 
@@ -434,6 +593,14 @@ void NavMap3D::sync() {
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
 
+	// Path queries run at any time, count the ones since the last sync.
+	const uint32_t cache_hits = path_corridor_cache_hits.get();
+	path_corridor_cache_hits.sub(cache_hits);
+	performance_data.pm_path_corridor_cache_hit_count = cache_hits;
+	const uint32_t cache_misses = path_corridor_cache_misses.get();
+	path_corridor_cache_misses.sub(cache_misses);
+	performance_data.pm_path_corridor_cache_miss_count = cache_misses;
+
 	_sync_async_tasks();
 
 	_sync_dirty_map_update_requests();
@@ -563,45 +730,75 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 	rvo_simulation_2d.kdTree_->buildObstacleTree(raw_obstacles);
 }
 
-void NavMap3D::_update_rvo_agents_tree_2d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO2D::Agent2D *> raw_agents;
-	raw_agents.reserve(active_2d_avoidance_agents.size());
-	for (NavAgent3D *agent : active_2d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_2d());
-	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
+void NavMap3D::_update_avoidance_grid_2d() {
+	rvo_agents_2d.resize(active_2d_avoidance_agents.size());
+	avoidance_grid_agents.resize(active_2d_avoidance_agents.size());
+	for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+		RVO2D::Agent2D *rvo_agent = active_2d_avoidance_agents[i]->get_rvo_agent_2d();
+		rvo_agents_2d[i] = rvo_agent;
+
+		NavAvoidanceGrid3D::Agent &grid_agent = avoidance_grid_agents[i];
+		grid_agent.position = Vector3(rvo_agent->position_.x(), rvo_agent->elevation_, rvo_agent->position_.y());
+		grid_agent.height = rvo_agent->height_;
+		grid_agent.neighbor_distance = rvo_agent->neighborDist_;
+		grid_agent.max_neighbors = rvo_agent->maxNeighbors_;
+		grid_agent.avoidance_layers = rvo_agent->avoidance_layers_;
+		grid_agent.avoidance_mask = rvo_agent->avoidance_mask_;
+		grid_agent.avoidance_priority = rvo_agent->avoidance_priority_;
+	}
+	avoidance_grid_2d.update(avoidance_grid_agents);
 }
 
-void NavMap3D::_update_rvo_agents_tree_3d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO3D::Agent3D *> raw_agents;
-	raw_agents.reserve(active_3d_avoidance_agents.size());
-	for (NavAgent3D *agent : active_3d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_3d());
-	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
+void NavMap3D::_update_avoidance_grid_3d() {
+	rvo_agents_3d.resize(active_3d_avoidance_agents.size());
+	avoidance_grid_agents.resize(active_3d_avoidance_agents.size());
+	for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+		RVO3D::Agent3D *rvo_agent = active_3d_avoidance_agents[i]->get_rvo_agent_3d();
+		rvo_agents_3d[i] = rvo_agent;
+
+		NavAvoidanceGrid3D::Agent &grid_agent = avoidance_grid_agents[i];
+		grid_agent.position = Vector3(rvo_agent->position_.x(), rvo_agent->position_.y(), rvo_agent->position_.z());
+		grid_agent.height = rvo_agent->height_;
+		grid_agent.neighbor_distance = rvo_agent->neighborDist_;
+		grid_agent.max_neighbors = rvo_agent->maxNeighbors_;
+		grid_agent.avoidance_layers = rvo_agent->avoidance_layers_;
+		grid_agent.avoidance_mask = rvo_agent->avoidance_mask_;
+		grid_agent.avoidance_priority = rvo_agent->avoidance_priority_;
+	}
+	avoidance_grid_3d.update(avoidance_grid_agents);
+}
+
+void NavMap3D::_compute_avoidance_neighbors_2d(uint32_t p_index) {
+	RVO2D::Agent2D *rvo_agent = rvo_agents_2d[p_index];
+
+	// Static obstacles still use the RVO kd-tree, it is only rebuilt when obstacles change.
+	rvo_agent->obstacleNeighbors_.clear();
+	const float obstacle_range = rvo_agent->timeHorizonObst_ * rvo_agent->maxSpeed_ + rvo_agent->radius_;
+	rvo_simulation_2d.kdTree_->computeObstacleNeighbors(rvo_agent, obstacle_range * obstacle_range);
+
+	avoidance_grid_2d.get_agent_neighbors(p_index, rvo_agents_2d.ptr(), rvo_agent->agentNeighbors_);
+}
+
+void NavMap3D::_compute_avoidance_neighbors_3d(uint32_t p_index) {
+	RVO3D::Agent3D *rvo_agent = rvo_agents_3d[p_index];
+	avoidance_grid_3d.get_agent_neighbors(p_index, rvo_agents_3d.ptr(), rvo_agent->agentNeighbors_);
 }
 
 void NavMap3D::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
-	if (agents_dirty) {
-		_update_rvo_agents_tree_2d();
-		_update_rvo_agents_tree_3d();
-	}
 }
 
 void NavMap3D::compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+	_compute_avoidance_neighbors_2d(index);
 	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 	(*(agent + index))->update();
 }
 
 void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+	_compute_avoidance_neighbors_3d(index);
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 	(*(agent + index))->update();
@@ -612,12 +809,15 @@ void NavMap3D::step(double p_delta_time) {
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
 	if (active_2d_avoidance_agents.size() > 0) {
+		_update_avoidance_grid_2d();
+
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+			for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+				NavAgent3D *agent = active_2d_avoidance_agents[i];
+				_compute_avoidance_neighbors_2d(i);
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 				agent->update();
@@ -626,12 +826,15 @@ void NavMap3D::step(double p_delta_time) {
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
+		_update_avoidance_grid_3d();
+
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
-			for (NavAgent3D *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+			for (uint32_t i = 0; i < active_3d_avoidance_agents.size(); i++) {
+				NavAgent3D *agent = active_3d_avoidance_agents[i];
+				_compute_avoidance_neighbors_3d(i);
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 				agent->update();
@@ -870,6 +1073,8 @@ NavMap3D::NavMap3D() {
 		path_query_slots_max = 1;
 	}
 
+	path_corridor_cache_size = MAX(0, (int)GLOBAL_GET("navigation/pathfinding/path_corridor_cache_size"));
+
 	iteration_slots.resize(2);
 
 	for (NavMapIteration3D &iteration_slot : iteration_slots) {
@@ -878,6 +1083,7 @@ NavMap3D::NavMap3D() {
 			iteration_slot.path_query_slots[i].slot_index = i;
 		}
 		iteration_slot.path_query_slots_semaphore.post(path_query_slots_max);
+		iteration_slot.path_corridor_cache.set_capacity(path_corridor_cache_size);
 	}
 
 #ifdef THREADS_ENABLED
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "3d/nav_avoidance_grid_3d.h"
 #include "3d/nav_map_iteration_3d.h"
 #include "3d/nav_mesh_queries_3d.h"
 #include "nav_rid_3d.h"
@@ -74,6 +75,9 @@ class NavMap3D : public NavRid3D {
 
 	bool map_settings_dirty = true;
 
+	/// Connections from an earlier build that are used instead of building them while they match the map.
+	Vector<uint8_t> connection_data;
+
 	/// Map regions
 	LocalVector<NavRegion3D *> regions;
 
@@ -88,6 +92,13 @@ class NavMap3D : public NavRid3D {
 	LocalVector<NavAgent3D *> active_2d_avoidance_agents;
 	LocalVector<NavAgent3D *> active_3d_avoidance_agents;
 
+	/// avoidance agent neighbor search, same order as the active avoidance agents
+	NavAvoidanceGrid3D avoidance_grid_2d = NavAvoidanceGrid3D(false);
+	NavAvoidanceGrid3D avoidance_grid_3d = NavAvoidanceGrid3D(true);
+	LocalVector<NavAvoidanceGrid3D::Agent> avoidance_grid_agents;
+	LocalVector<RVO2D::Agent2D *> rvo_agents_2d;
+	LocalVector<RVO3D::Agent3D *> rvo_agents_3d;
+
 	/// dirty flag when one of the agent's arrays are modified
 	bool agents_dirty = true;
 
@@ -109,6 +120,8 @@ class NavMap3D : public NavRid3D {
 
 	// Performance Monitor
 	Nav3D::PerformanceData performance_data;
+	SafeNumeric<uint32_t> path_corridor_cache_hits;
+	SafeNumeric<uint32_t> path_corridor_cache_misses;
 
 	struct {
 		struct {
@@ -137,6 +150,7 @@ class NavMap3D : public NavRid3D {
 	} async_dirty_requests;
 
 	int path_query_slots_max = 4;
+	int path_corridor_cache_size = 0;
 
 	bool use_async_iterations = true;
 
@@ -204,6 +218,7 @@ public:
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
 	Nav3D::ClosestPointQueryResult get_closest_point_info(const Vector3 &p_point) const;
 	RID get_closest_point_owner(const Vector3 &p_point) const;
+	Vector3 get_flow_direction(const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers) const;
 
 	void add_region(NavRegion3D *p_region);
 	void remove_region(NavRegion3D *p_region);
@@ -236,6 +251,11 @@ public:
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
 
+	void set_connection_data(const Vector<uint8_t> &p_data);
+	Vector<uint8_t> get_connection_data() const;
+
+	int64_t get_memory_usage() const;
+
 	void sync();
 	void step(double p_delta_time);
 	void dispatch_callbacks();
@@ -250,6 +270,10 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	uint64_t get_pm_iteration_build_time() const { return performance_data.pm_iteration_build_time; }
+	int get_pm_path_corridor_cache_hit_count() const { return performance_data.pm_path_corridor_cache_hit_count; }
+	int get_pm_path_corridor_cache_miss_count() const { return performance_data.pm_path_corridor_cache_miss_count; }
+	bool get_pm_connection_data_loaded() const { return performance_data.pm_connection_data_loaded; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -284,8 +308,10 @@ private:
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
-	void _update_rvo_agents_tree_2d();
-	void _update_rvo_agents_tree_3d();
+	void _update_avoidance_grid_2d();
+	void _update_avoidance_grid_3d();
+	void _compute_avoidance_neighbors_2d(uint32_t p_index);
+	void _compute_avoidance_neighbors_3d(uint32_t p_index);
 
 	void _update_merge_rasterizer_cell_dimensions();
 };
@@ -31,9 +31,11 @@
 #pragma once
 
 #include "core/math/vector3.h"
+#include "core/os/mutex.h"
 #include "core/templates/hashfuncs.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
+#include "core/templates/safe_refcount.h"
 
 #include <cfloat> // FLT_MAX
 
@@ -106,6 +108,24 @@ struct Polygon {
 	real_t surface_area = 0.0;
 };
 
+struct ClusterPortal {
+	/// Index of the cluster that this portal leads to.
+	uint32_t cluster = UINT32_MAX;
+
+	/// Average position of all connection pathways between the two clusters.
+	Vector3 position;
+};
+
+/// A navigation region or link as a node of the abstract graph used by the hierarchical path search.
+struct NavBaseCluster {
+	const NavBaseIteration3D *navbase = nullptr;
+
+	/// Index of the first polygon of this region or link when all polygons of the map are numbered in cluster order.
+	uint32_t polygon_offset = 0;
+
+	LocalVector<ClusterPortal> portals;
+};
+
 struct NavigationPoly {
 	/// This poly.
 	const Polygon *poly = nullptr;
@@ -171,6 +191,152 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// The cluster this one was entered from.
+	int back_navigation_cluster_id = -1;
+
+	/// The portal position this cluster was entered through.
+	Vector3 entry;
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = 0.0;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// True if the cluster is part of the abstract path the polygon search is restricted to.
+	bool in_corridor = false;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = -1;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
+struct FlowFieldPolygon {
+	/// Index in the heap of polygons to settle next.
+	uint32_t traversable_poly_index = UINT32_MAX;
+
+	/// The travel cost from this polygon to the target, FLT_MAX if the target is unreachable.
+	real_t travel_cost = FLT_MAX;
+
+	/// The position the travel cost is measured from.
+	Vector3 entry;
+
+	/// The pathway that leads out of this polygon towards the target.
+	Vector3 pathway_start;
+	Vector3 pathway_end;
+};
+
+struct FlowFieldPolygonCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const FlowFieldPolygon *p_poly_a, const FlowFieldPolygon *p_poly_b) const {
+		return p_poly_a->travel_cost > p_poly_b->travel_cost;
+	}
+};
+
+struct FlowFieldPolygonHeapIndexer {
+	void operator()(FlowFieldPolygon *p_poly, uint32_t p_heap_index) const {
+		p_poly->traversable_poly_index = p_heap_index;
+	}
+};
+
+struct FlowFieldKey {
+	Vector3 target_position;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const FlowFieldKey &p_val) {
+		return hash_murmur3_one_32(p_val.navigation_layers, p_val.target_position.hash());
+	}
+
+	bool operator==(const FlowFieldKey &p_key) const {
+		return target_position == p_key.target_position && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+/// The travel costs and directions of all polygons of a map towards one target, indexed like `NavBaseCluster::polygon_offset`.
+/// Shared by the flow field cache and the queries reading it, the last one to drop its reference frees it.
+struct FlowField {
+	SafeRefCount refcount;
+
+	/// Held by the query building the field, other queries for the same target wait on it instead of on the whole cache.
+	Mutex build_mutex;
+	SafeFlag built;
+
+	LocalVector<FlowFieldPolygon> polygons;
+	uint32_t target_polygon_index = UINT32_MAX;
+	Vector3 target_position;
+};
+
+/// The region polygons of a map bucketed by their bounds on the XZ plane, to find the polygon closest to a point without testing all of them.
+struct PolygonGrid {
+	SafeFlag built;
+
+	Vector3 origin;
+	real_t cell_size = 0.0;
+	int32_t width = 0;
+	int32_t depth = 0;
+
+	/// The polygons of cell `i` are `cell_polygons[cell_offsets[i]]` to `cell_polygons[cell_offsets[i + 1] - 1]`.
+	LocalVector<uint32_t> cell_offsets;
+	LocalVector<const Polygon *> cell_polygons;
+};
+
+struct PathCorridorKey {
+	const Polygon *begin_polygon = nullptr;
+	const Polygon *end_polygon = nullptr;
+	uint32_t navigation_layers = 0;
+	uint32_t pathfinding_algorithm = 0;
+	int path_search_max_polygons = 0;
+
+	static uint32_t hash(const PathCorridorKey &p_val) {
+		uint32_t h = hash_murmur3_one_64((uint64_t)p_val.begin_polygon);
+		h = hash_murmur3_one_64((uint64_t)p_val.end_polygon, h);
+		h = hash_murmur3_one_32(p_val.navigation_layers, h);
+		h = hash_murmur3_one_32(p_val.pathfinding_algorithm, h);
+		h = hash_murmur3_one_32(p_val.path_search_max_polygons, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const PathCorridorKey &p_key) const {
+		return begin_polygon == p_key.begin_polygon && end_polygon == p_key.end_polygon && navigation_layers == p_key.navigation_layers && pathfinding_algorithm == p_key.pathfinding_algorithm && path_search_max_polygons == p_key.path_search_max_polygons;
+	}
+};
+
+/// The polygons a path crosses from its begin polygon to its end polygon, with the pathway it entered each polygon through.
+struct PathCorridor {
+	LocalVector<NavigationPoly> polygons;
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -192,6 +358,10 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	uint64_t pm_iteration_build_time = 0; // In microseconds.
+	int pm_path_corridor_cache_hit_count = 0;
+	int pm_path_corridor_cache_miss_count = 0;
+	bool pm_connection_data_loaded = false; // Whether the last build loaded the connections from the connection data.
 
 	void reset() {
 		pm_region_count = 0;
@@ -203,6 +373,10 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_iteration_build_time = 0;
+		pm_path_corridor_cache_hit_count = 0;
+		pm_path_corridor_cache_miss_count = 0;
+		pm_connection_data_loaded = false;
 	}
 };
 
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_nav_avoidance_grid_3d.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../3d/nav_avoidance_grid_3d.h"
+
+#include "core/math/random_pcg.h"
+#include "tests/test_macros.h"
+
+namespace TestNavAvoidanceGrid3D {
+
+// Reference neighbor search with the same rules as the RVO kd-tree, by checking every agent.
+static LocalVector<uint32_t> get_reference_neighbors(const LocalVector<NavAvoidanceGrid3D::Agent> &p_agents, uint32_t p_agent_index, bool p_use_3d) {
+	const NavAvoidanceGrid3D::Agent &agent = p_agents[p_agent_index];
+
+	LocalVector<Pair<float, uint32_t>> candidates;
+	for (uint32_t i = 0; i < p_agents.size(); i++) {
+		const NavAvoidanceGrid3D::Agent &other = p_agents[i];
+		if (i == p_agent_index || (agent.avoidance_mask & other.avoidance_layers) == 0) {
+			continue;
+		}
+		if (!p_use_3d && (agent.position.y > other.position.y + other.height || agent.position.y + agent.height < other.position.y)) {
+			continue;
+		}
+		if (agent.avoidance_priority > other.avoidance_priority) {
+			continue;
+		}
+		const float dx = agent.position.x - other.position.x;
+		const float dy = p_use_3d ? agent.position.y - other.position.y : 0.0f;
+		const float dz = agent.position.z - other.position.z;
+		const float dist_sq = dx * dx + dy * dy + dz * dz;
+		if (dist_sq < agent.neighbor_distance * agent.neighbor_distance) {
+			candidates.push_back(Pair<float, uint32_t>(dist_sq, i));
+		}
+	}
+	candidates.sort_custom<PairSort<float, uint32_t>>();
+
+	LocalVector<uint32_t> neighbors;
+	for (uint32_t i = 0; i < candidates.size() && i < agent.max_neighbors; i++) {
+		neighbors.push_back(candidates[i].second);
+	}
+	return neighbors;
+}
+
+static void check_neighbors_match_reference(const NavAvoidanceGrid3D &p_grid, const LocalVector<NavAvoidanceGrid3D::Agent> &p_agents, bool p_use_3d) {
+	LocalVector<uint32_t> agent_ids;
+	LocalVector<uint32_t *> agent_ptrs;
+	agent_ids.resize(p_agents.size());
+	agent_ptrs.resize(p_agents.size());
+	for (uint32_t i = 0; i < p_agents.size(); i++) {
+		agent_ids[i] = i;
+		agent_ptrs[i] = &agent_ids[i];
+	}
+
+	bool all_match = true;
+	std::vector<std::pair<float, const uint32_t *>> neighbors;
+	for (uint32_t i = 0; i < p_agents.size(); i++) {
+		p_grid.get_agent_neighbors(i, agent_ptrs.ptr(), neighbors);
+		const LocalVector<uint32_t> reference_neighbors = get_reference_neighbors(p_agents, i, p_use_3d);
+
+		if (neighbors.size() != reference_neighbors.size()) {
+			all_match = false;
+			continue;
+		}
+		for (uint32_t j = 0; j < reference_neighbors.size(); j++) {
+			all_match = all_match && *neighbors[j].second == reference_neighbors[j];
+		}
+	}
+	CHECK(all_match);
+}
+
+static LocalVector<NavAvoidanceGrid3D::Agent> create_agents(RandomPCG &p_rng, uint32_t p_count) {
+	LocalVector<NavAvoidanceGrid3D::Agent> agents;
+	agents.resize(p_count);
+	for (NavAvoidanceGrid3D::Agent &agent : agents) {
+		agent.position = Vector3(p_rng.random(-50.0f, 50.0f), p_rng.random(-2.0f, 2.0f), p_rng.random(-50.0f, 50.0f));
+		agent.height = 1.5;
+		agent.neighbor_distance = p_rng.random(2.0f, 8.0f);
+		agent.max_neighbors = p_rng.rand(12);
+		agent.avoidance_layers = 1 + p_rng.rand(3);
+		agent.avoidance_mask = 1 + p_rng.rand(3);
+		agent.avoidance_priority = p_rng.rand(2);
+	}
+	return agents;
+}
+
+TEST_CASE("[Navigation3D] Avoidance grid neighbors should match a full search") {
+	for (bool use_3d : { false, true }) {
+		RandomPCG rng = RandomPCG(use_3d ? 3 : 2);
+		LocalVector<NavAvoidanceGrid3D::Agent> agents = create_agents(rng, 500);
+
+		NavAvoidanceGrid3D grid = NavAvoidanceGrid3D(use_3d);
+		grid.update(agents);
+		check_neighbors_match_reference(grid, agents, use_3d);
+
+		// Small moves keep most agents in their cells, the update must still catch the ones that leave them.
+		for (NavAvoidanceGrid3D::Agent &agent : agents) {
+			agent.position += Vector3(rng.random(-0.1f, 0.1f), rng.random(-0.1f, 0.1f), rng.random(-0.1f, 0.1f));
+		}
+		grid.update(agents);
+		check_neighbors_match_reference(grid, agents, use_3d);
+
+		// Agent properties change without any agent changing its cell.
+		for (NavAvoidanceGrid3D::Agent &agent : agents) {
+			agent.avoidance_layers = 1 + rng.rand(3);
+		}
+		grid.update(agents);
+		check_neighbors_match_reference(grid, agents, use_3d);
+
+		agents.resize(300);
+		grid.update(agents);
+		check_neighbors_match_reference(grid, agents, use_3d);
+	}
+}
+
+} // namespace TestNavAvoidanceGrid3D
@@ -0,0 +1,350 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+#include "core/object/class_db.h"
+#include "core/object/script_language.h"
+#include "core/variant/typed_array.h"
+#include "scene/main/scene_tree.h"
+
+void ScenePool::_reset_to_defaults(Node *p_node, const HashSet<StringName> &p_skip_properties) const {
+	List<PropertyInfo> properties;
+	p_node->get_property_list(&properties);
+
+	Ref<Script> node_script = p_node->get_script();
+
+	for (const PropertyInfo &pi : properties) {
+		if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringName(script) || p_skip_properties.has(pi.name)) {
+			continue;
+		}
+
+		const String name = pi.name;
+		if (name.begins_with("metadata/")) {
+			// Metadata has no default, it only exists if it was packed or added at runtime.
+			p_node->remove_meta(name.trim_prefix("metadata/"));
+			continue;
+		}
+
+		Variant value;
+		bool valid = node_script.is_valid() && node_script->get_property_default_value(pi.name, value);
+		if (!valid) {
+			value = ClassDB::class_get_default_property_value(p_node->get_class_name(), pi.name, &valid);
+		}
+		if (!valid) {
+			continue;
+		}
+
+		if (value.get_type() == Variant::OBJECT && value.get_validated_object() != nullptr) {
+			// Never share an object owned by the class default instance.
+			continue;
+		} else if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate();
+		}
+
+		if (p_node->get(pi.name) != value) {
+			p_node->set(pi.name, value);
+		}
+	}
+}
+
+void ScenePool::_reset_to_state(Node *p_root, const Ref<SceneState> &p_state, HashMap<Node *, Vector<StringName>> &r_node_groups) const {
+	for (int i = 0; i < p_state->get_node_count(); i++) {
+		Node *node = p_root->get_node_or_null(p_state->get_node_path(i));
+		if (!node) {
+			// Removed while in use, nothing to restore.
+			continue;
+		}
+
+		// Instanced and inherited scenes store only their overrides, start from the state of the scene they come from.
+		Ref<PackedScene> instance = p_state->get_node_instance(i);
+		if (instance.is_valid()) {
+			_reset_to_state(node, instance->get_state(), r_node_groups);
+		}
+
+		HashSet<StringName> packed_properties;
+		for (int j = 0; j < p_state->get_node_property_count(i); j++) {
+			packed_properties.insert(p_state->get_node_property_name(i, j));
+		}
+
+		// Nodes created by this state start from their class defaults, others were reset by the state they come from.
+		if (p_state->get_node_type(i) != StringName()) {
+			_reset_to_defaults(node, packed_properties);
+		}
+
+		const Vector<String> deferred_properties = p_state->get_node_deferred_nodepath_properties(i);
+
+		for (int j = 0; j < p_state->get_node_property_count(i); j++) {
+			const StringName name = p_state->get_node_property_name(i, j);
+			if (name == CoreStringName(script)) {
+				continue;
+			}
+
+			Variant value = p_state->get_node_property_value(i, j);
+
+			if (deferred_properties.has(name)) {
+				// Node references are stored as paths, only single nodes can be resolved back here.
+				if (value.get_type() != Variant::NODE_PATH) {
+					continue;
+				}
+				value = node->get_node_or_null(value);
+			} else if (value.get_type() == Variant::OBJECT) {
+				// Keep the copy that was made for this instance.
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					continue;
+				}
+			} else if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				// Don't share containers with the scene state.
+				value = value.duplicate();
+			}
+
+			node->set(name, value);
+		}
+
+		r_node_groups[node].append_array(p_state->get_node_groups(i));
+	}
+}
+
+void ScenePool::_reset_groups(Node *p_node, const Vector<StringName> &p_packed_groups) const {
+	List<Node::GroupInfo> groups;
+	p_node->get_groups(&groups);
+
+	for (const Node::GroupInfo &group : groups) {
+		// Non-persistent groups starting with an underscore are managed by the engine.
+		if (!p_packed_groups.has(group.name) && (group.persistent || !String(group.name).begins_with("_"))) {
+			p_node->remove_from_group(group.name);
+		}
+	}
+
+	for (const StringName &group : p_packed_groups) {
+		if (!p_node->is_in_group(group)) {
+			p_node->add_to_group(group, true);
+		}
+	}
+}
+
+void ScenePool::_remove_added_nodes(Node *p_node, const HashMap<Node *, Vector<StringName>> &p_packed_nodes) const {
+	// Internal children are created by the nodes themselves and are never packed.
+	for (int i = p_node->get_child_count(false) - 1; i >= 0; i--) {
+		Node *child = p_node->get_child(i, false);
+		if (p_packed_nodes.has(child)) {
+			_remove_added_nodes(child, p_packed_nodes);
+		} else {
+			p_node->remove_child(child);
+			_free_node(child);
+		}
+	}
+}
+
+void ScenePool::_reset_to_packed_state(Node *p_root) const {
+	HashMap<Node *, Vector<StringName>> packed_nodes;
+	_reset_to_state(p_root, scene->get_state(), packed_nodes);
+
+	_remove_added_nodes(p_root, packed_nodes);
+
+	for (const KeyValue<Node *, Vector<StringName>> &E : packed_nodes) {
+		_reset_groups(E.key, E.value);
+	}
+}
+
+void ScenePool::_prune_in_use() {
+	LocalVector<ObjectID> freed;
+	for (const ObjectID &id : in_use) {
+		if (!ObjectDB::get_instance(id)) {
+			freed.push_back(id);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		in_use.erase(id);
+	}
+}
+
+void ScenePool::_free_node(Node *p_node) const {
+	// The node may be released from one of its own callbacks, so defer when possible.
+	if (SceneTree::get_singleton()) {
+		p_node->queue_free();
+	} else {
+		memdelete(p_node);
+	}
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+
+	clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	max_size = p_size;
+
+	while ((int)available.size() > max_size) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node) {
+			_free_node(node);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+Node *ScenePool::acquire() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene set in this pool.");
+
+	// Instances freed by the caller instead of being released are no longer in use.
+	_prune_in_use();
+
+	while (!available.is_empty()) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node) {
+			hit_count++;
+			in_use.insert(node->get_instance_id());
+			return node;
+		}
+	}
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	miss_count++;
+	in_use.insert(node->get_instance_id());
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(!in_use.erase(p_node->get_instance_id()), "Node was not acquired from this pool.");
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= max_size) {
+		_free_node(p_node);
+		return;
+	}
+
+	_reset_to_packed_state(p_node);
+	// Run `_ready()` again the next time it enters the tree, like a new instance would.
+	p_node->request_ready();
+
+	available.push_back(p_node->get_instance_id());
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND_MSG(scene.is_null(), "No scene set in this pool.");
+	ERR_FAIL_COND(p_count < 0);
+
+	const int count = MIN(p_count, max_size) - (int)available.size();
+	if (count <= 0) {
+		return;
+	}
+
+	TypedArray<Node> nodes = scene->instantiate_batch(count);
+	for (int i = 0; i < nodes.size(); i++) {
+		Node *node = Object::cast_to<Node>(nodes[i]);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+void ScenePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			_free_node(node);
+		}
+	}
+	available.clear();
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+int ScenePool::get_in_use_count() const {
+	int count = 0;
+	for (const ObjectID &id : in_use) {
+		if (ObjectDB::get_instance(id)) {
+			count++;
+		}
+	}
+	return count;
+}
+
+uint64_t ScenePool::get_hit_count() const {
+	return hit_count;
+}
+
+uint64_t ScenePool::get_miss_count() const {
+	return miss_count;
+}
+
+void ScenePool::reset_statistics() {
+	hit_count = 0;
+	miss_count = 0;
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_in_use_count"), &ScenePool::get_in_use_count);
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &ScenePool::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &ScenePool::get_miss_count);
+	ClassDB::bind_method(D_METHOD("reset_statistics"), &ScenePool::reset_statistics);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, PackedScene::get_class_static()), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
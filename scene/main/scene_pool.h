@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	Ref<PackedScene> scene;
+	int max_size = 64;
+
+	LocalVector<ObjectID> available;
+	HashSet<ObjectID> in_use;
+
+	uint64_t hit_count = 0;
+	uint64_t miss_count = 0;
+
+	void _reset_to_defaults(Node *p_node, const HashSet<StringName> &p_skip_properties) const;
+	void _reset_to_state(Node *p_root, const Ref<SceneState> &p_state, HashMap<Node *, Vector<StringName>> &r_node_groups) const;
+	void _reset_groups(Node *p_node, const Vector<StringName> &p_packed_groups) const;
+	void _remove_added_nodes(Node *p_node, const HashMap<Node *, Vector<StringName>> &p_packed_nodes) const;
+	void _reset_to_packed_state(Node *p_root) const;
+	void _prune_in_use();
+	void _free_node(Node *p_node) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_size);
+	int get_max_size() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prewarm(int p_count);
+	void clear();
+
+	int get_available_count() const;
+	int get_in_use_count() const;
+
+	uint64_t get_hit_count() const;
+	uint64_t get_miss_count() const;
+	void reset_statistics();
+
+	~ScenePool();
+};
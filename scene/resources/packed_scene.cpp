@@ -266,6 +266,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
 
+	// Editor instantiation goes through `Object::set()`, which also flags objects as edited.
+	const bool use_property_setters = p_edit_state == GEN_EDIT_STATE_DISABLED;
+	if (use_property_setters) {
+		_update_property_setters();
+	}
+
 	HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> resources_local_to_scenes; // Record the mappings in sub-scenes.
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
@@ -439,6 +445,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// Only valid if the node is exactly the class the setters were resolved for.
+				const PropertySetter *nsetters = nullptr;
+				if (use_property_setters && n.type != TYPE_INSTANTIATED && n.instance < 0 && node->get_class_name() == snames[n.type]) {
+					nsetters = &property_setters[property_setter_offsets[i]];
+				}
+
 				Dictionary missing_resource_properties;
 
 				for (int j = 0; j < nprop_count; j++) {
@@ -564,7 +576,20 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (nsetters && nsetters[j].method && !node->get_script_instance()) {
+								// Same call `ClassDB::set_property()` would make, without the lookup.
+								Callable::CallError ce;
+								if (nsetters[j].index >= 0) {
+									const Variant index = nsetters[j].index;
+									const Variant *args[2] = { &index, &value };
+									nsetters[j].method->call(node, args, 2, ce);
+								} else {
+									const Variant *args[1] = { &value };
+									nsetters[j].method->call(node, args, 1, ce);
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -773,6 +798,47 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+void SceneState::_update_property_setters() const {
+	if (property_setters_valid.is_set()) {
+		return;
+	}
+
+	MutexLock lock(property_setters_mutex);
+	if (property_setters_valid.is_set()) {
+		return;
+	}
+
+	property_setters.clear();
+	property_setter_offsets.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		property_setter_offsets[i] = property_setters.size();
+
+		// Extension classes may intercept `set()` before ClassDB is queried, so leave them alone.
+		bool resolve = n.type != TYPE_INSTANTIATED && n.instance < 0 && n.type >= 0 && n.type < names.size();
+		if (resolve) {
+			const StringName &type = names[n.type];
+			resolve = ClassDB::class_exists(type) && (ClassDB::get_api_type(type) == ClassDB::API_CORE || ClassDB::get_api_type(type) == ClassDB::API_EDITOR);
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			PropertySetter setter;
+			if (resolve && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name >= 0 && prop.name < names.size()) {
+				const StringName &type = names[n.type];
+				const StringName setter_name = ClassDB::get_property_setter(type, names[prop.name]);
+				if (setter_name != StringName()) {
+					setter.method = ClassDB::get_method(type, setter_name);
+					setter.index = ClassDB::get_property_index(type, names[prop.name]);
+				}
+			}
+			property_setters.push_back(setter);
+		}
+	}
+
+	property_setters_valid.set();
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -1502,6 +1568,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	property_setters_valid.clear();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1736,6 +1803,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	property_setters_valid.clear();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1749,8 +1818,9 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 		int namecount = snames.size();
 		names.resize(namecount);
 		const String *r = snames.ptr();
-		for (int i = 0; i < names.size(); i++) {
-			names.write[i] = r[i];
+		StringName *w = names.ptrw();
+		for (int i = 0; i < namecount; i++) {
+			w[i] = r[i];
 		}
 	}
 
@@ -1759,8 +1829,9 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	if (svariants.size()) {
 		int varcount = svariants.size();
 		variants.resize(varcount);
+		Variant *w = variants.ptrw();
 		for (int i = 0; i < varcount; i++) {
-			variants.write[i] = svariants[i];
+			w[i] = svariants[i];
 		}
 
 	} else {
@@ -1770,9 +1841,10 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	nodes.resize(node_count);
 	if (node_count) {
 		const int *r = snodes.ptr();
+		NodeData *w = nodes.ptrw();
 		int idx = 0;
 		for (int i = 0; i < node_count; i++) {
-			NodeData &nd = nodes.write[i];
+			NodeData &nd = w[i];
 			nd.parent = r[idx++];
 			nd.owner = r[idx++];
 			nd.type = r[idx++];
@@ -1781,14 +1853,18 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 			nd.index = (name_index >> NAME_INDEX_BITS);
 			nd.index--; //0 is invalid, stored as 1
 			nd.instance = r[idx++];
-			nd.properties.resize(r[idx++]);
-			for (int j = 0; j < nd.properties.size(); j++) {
-				nd.properties.write[j].name = r[idx++];
-				nd.properties.write[j].value = r[idx++];
+			const int property_count = r[idx++];
+			nd.properties.resize(property_count);
+			NodeData::Property *props = nd.properties.ptrw();
+			for (int j = 0; j < property_count; j++) {
+				props[j].name = r[idx++];
+				props[j].value = r[idx++];
 			}
-			nd.groups.resize(r[idx++]);
-			for (int j = 0; j < nd.groups.size(); j++) {
-				nd.groups.write[j] = r[idx++];
+			const int group_count = r[idx++];
+			nd.groups.resize(group_count);
+			int *groups = nd.groups.ptrw();
+			for (int j = 0; j < group_count; j++) {
+				groups[j] = r[idx++];
 			}
 		}
 	}
@@ -1796,9 +1872,10 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	connections.resize(conn_count);
 	if (conn_count) {
 		const int *r = sconns.ptr();
+		ConnectionData *w = connections.ptrw();
 		int idx = 0;
 		for (int i = 0; i < conn_count; i++) {
-			ConnectionData &cd = connections.write[i];
+			ConnectionData &cd = w[i];
 			cd.from = r[idx++];
 			cd.to = r[idx++];
 			cd.signal = r[idx++];
@@ -2389,6 +2466,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	property_setters_valid.clear();
 
 	ids.push_back(p_unique_id);
 
@@ -2407,6 +2485,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	property_setters_valid.clear();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -2594,6 +2673,25 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_batch(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *s = instantiate(p_edit_state);
+		if (!s) {
+			for (int j = 0; j < i; j++) {
+				memdelete(Object::cast_to<Node>(ret[j]));
+			}
+			return TypedArray<Node>();
+		}
+		ret[i] = s;
+	}
+
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2680,6 +2778,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_batch", "count", "edit_state"), &PackedScene::instantiate_batch, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class PackedScene;
@@ -92,6 +95,20 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Setters resolved once per state, so runtime instantiation can call them
+	// directly instead of looking each property up in ClassDB for every node.
+	struct PropertySetter {
+		const MethodBind *method = nullptr; // Null means falling back to `Object::set()`.
+		int index = -1;
+	};
+
+	mutable LocalVector<PropertySetter> property_setters;
+	mutable LocalVector<uint32_t> property_setter_offsets; // First setter of each node.
+	mutable SafeFlag property_setters_valid;
+	mutable BinaryMutex property_setters_mutex;
+
+	void _update_property_setters() const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -273,6 +290,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_batch(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -34,6 +34,7 @@ namespace NavigationEnums3D {
 
 enum PathfindingAlgorithm {
 	PATHFINDING_ALGORITHM_ASTAR = 0,
+	PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR = 1,
 };
 
 enum PathPostProcessing {
@@ -73,6 +74,7 @@ constexpr const char *const NAV_MESH_CELL_SIZE_HINT = "0.001,100,0.001,or_greate
 constexpr float EDGE_CONNECTION_MARGIN = 0.25f;
 constexpr float LINK_CONNECTION_RADIUS = 1.0f;
 constexpr int path_search_max_polygons = 4096;
+constexpr int flow_field_cache_max = 32;
 
 // Agent.
 
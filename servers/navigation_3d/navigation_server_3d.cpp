@@ -72,6 +72,7 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_normal", "map", "to_point"), &NavigationServer3D::map_get_closest_point_normal);
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_owner", "map", "to_point"), &NavigationServer3D::map_get_closest_point_owner);
+	ClassDB::bind_method(D_METHOD("map_get_flow_direction", "map", "position", "target_position", "navigation_layers"), &NavigationServer3D::map_get_flow_direction, DEFVAL(1));
 
 	ClassDB::bind_method(D_METHOD("map_get_links", "map"), &NavigationServer3D::map_get_links);
 	ClassDB::bind_method(D_METHOD("map_get_regions", "map"), &NavigationServer3D::map_get_regions);
@@ -85,7 +86,13 @@ void NavigationServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
 
+	ClassDB::bind_method(D_METHOD("map_set_connection_data", "map", "data"), &NavigationServer3D::map_set_connection_data);
+	ClassDB::bind_method(D_METHOD("map_get_connection_data", "map"), &NavigationServer3D::map_get_connection_data);
+
+	ClassDB::bind_method(D_METHOD("map_get_memory_usage", "map"), &NavigationServer3D::map_get_memory_usage);
+
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer3D::query_path_async, DEFVAL(Callable()));
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer3D::region_get_iteration_id);
@@ -239,6 +246,11 @@ void NavigationServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_QUERY_PENDING_COUNT);
+	BIND_ENUM_CONSTANT(INFO_MAP_BUILD_TIME);
+	BIND_ENUM_CONSTANT(INFO_PATH_CORRIDOR_CACHE_HIT_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CORRIDOR_CACHE_MISS_COUNT);
+	BIND_ENUM_CONSTANT(INFO_CONNECTION_DATA_LOAD_COUNT);
 }
 
 NavigationServer3D *NavigationServer3D::get_singleton() {
@@ -93,6 +93,7 @@ public:
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const = 0;
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const = 0;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector3 &p_point) const = 0;
+	virtual Vector3 map_get_flow_direction(RID p_map, const Vector3 &p_position, const Vector3 &p_target_position, uint32_t p_navigation_layers = 1) const = 0;
 
 	virtual TypedArray<RID> map_get_links(RID p_map) const = 0;
 	virtual TypedArray<RID> map_get_regions(RID p_map) const = 0;
@@ -107,6 +108,11 @@ public:
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
+	virtual void map_set_connection_data(RID p_map, Vector<uint8_t> p_data) = 0;
+	virtual Vector<uint8_t> map_get_connection_data(RID p_map) const = 0;
+
+	virtual int64_t map_get_memory_usage(RID p_map) const = 0;
+
 	/* REGION API */
 
 	virtual RID region_create() = 0;
@@ -281,6 +287,7 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 	/* NAVMESH BAKE API */
 
@@ -334,6 +341,11 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_PATH_QUERY_PENDING_COUNT,
+		INFO_MAP_BUILD_TIME,
+		INFO_PATH_CORRIDOR_CACHE_HIT_COUNT,
+		INFO_PATH_CORRIDOR_CACHE_MISS_COUNT,
+		INFO_CONNECTION_DATA_LOAD_COUNT,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
@@ -72,6 +72,8 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer2D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer2D::space_restore_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer2D::area_set_space);
@@ -325,6 +327,14 @@ void PhysicsServer2D::_bind_methods() {
 	BIND_ENUM_CONSTANT(PS2DE::INFO_ISLAND_COUNT);
 }
 
+Vector<uint8_t> PhysicsServer2D::space_save_state(RID p_space) const {
+	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Saving space state is not supported by this physics server.");
+}
+
+bool PhysicsServer2D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	ERR_FAIL_V_MSG(false, "Restoring space state is not supported by this physics server.");
+}
+
 PhysicsServer2D::PhysicsServer2D() {
 	singleton = this;
 
@@ -344,6 +354,7 @@ PhysicsServer2D::PhysicsServer2D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/2d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.01,10,0.01,or_greater"), 0.3);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/2d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/2d/solver/default_constraint_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.2);
+	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/2d/solver/deterministic"), false);
 }
 
 PhysicsServer2D::~PhysicsServer2D() {
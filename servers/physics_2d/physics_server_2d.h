@@ -92,6 +92,10 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshots of the simulated body state, for rollback. Not every server supports them.
+	virtual Vector<uint8_t> space_save_state(RID p_space) const;
+	virtual bool space_restore_state(RID p_space, const Vector<uint8_t> &p_state);
+
 	//missing space parameters
 
 	/* AREA API */
@@ -165,6 +165,8 @@ public:
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override {}
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override { return Vector<Vector2>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
+	virtual Vector<uint8_t> space_save_state(RID p_space) const override { return Vector<uint8_t>(); }
+	virtual bool space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override { return false; }
 
 	/* AREA API */
 
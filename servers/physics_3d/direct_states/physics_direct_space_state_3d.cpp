@@ -31,8 +31,12 @@
 #include "physics_direct_space_state_3d.h"
 
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
+// Below this amount of queries, dispatching to the WorkerThreadPool costs more than it saves.
+#define BATCH_PARALLEL_MIN_QUERIES 64
+
 Dictionary PhysicsDirectSpaceState3D::_intersect_ray(RequiredParam<PhysicsRayQueryParameters3D> p_ray_query) {
 	EXTRACT_PARAM_OR_FAIL_V(ray_query, p_ray_query, Dictionary());
 
@@ -154,6 +158,223 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(RequiredParam<PhysicsShapeQ
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays_batch(RequiredParam<PhysicsRayQueryParameters3D> p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to, const PackedInt32Array &p_collision_masks) {
+	EXTRACT_PARAM_OR_FAIL_V(ray_query, p_ray_query, Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The 'from' and 'to' arrays must have the same size.");
+	ERR_FAIL_COND_V_MSG(!p_collision_masks.is_empty() && p_collision_masks.size() != p_from.size(), Dictionary(), "The 'collision_masks' array must be empty or have the same size as the 'from' array.");
+
+	const int count = p_from.size();
+
+	Vector<PS3DT::RayResult> results;
+	results.resize(count);
+	Vector<uint8_t> hits;
+	hits.resize(count);
+
+	static_assert(sizeof(bool) == sizeof(uint8_t));
+	intersect_rays_batch(ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), p_collision_masks.is_empty() ? nullptr : reinterpret_cast<const uint32_t *>(p_collision_masks.ptr()), count, results.ptrw(), reinterpret_cast<bool *>(hits.ptrw()));
+
+	PackedVector3Array positions;
+	positions.resize(count);
+	PackedVector3Array normals;
+	normals.resize(count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(count);
+	PackedInt32Array shapes;
+	shapes.resize(count);
+	PackedInt32Array face_indices;
+	face_indices.resize(count);
+
+	Vector3 *positions_ptrw = positions.ptrw();
+	Vector3 *normals_ptrw = normals.ptrw();
+	int64_t *collider_ids_ptrw = collider_ids.ptrw();
+	int32_t *shapes_ptrw = shapes.ptrw();
+	int32_t *face_indices_ptrw = face_indices.ptrw();
+	const PS3DT::RayResult *results_ptr = results.ptr();
+	const uint8_t *hits_ptr = hits.ptr();
+
+	for (int i = 0; i < count; i++) {
+		if (hits_ptr[i]) {
+			positions_ptrw[i] = results_ptr[i].position;
+			normals_ptrw[i] = results_ptr[i].normal;
+			collider_ids_ptrw[i] = int64_t(results_ptr[i].collider_id);
+			shapes_ptrw[i] = results_ptr[i].shape;
+			face_indices_ptrw[i] = results_ptr[i].face_index;
+		} else {
+			positions_ptrw[i] = Vector3();
+			normals_ptrw[i] = Vector3();
+			collider_ids_ptrw[i] = 0;
+			shapes_ptrw[i] = -1;
+			face_indices_ptrw[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["collided"] = hits;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["face_index"] = face_indices;
+
+	return d;
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes_batch(RequiredParam<PhysicsShapeQueryParameters3D> p_shape_query, const PackedVector3Array &p_origins, int p_max_results) {
+	EXTRACT_PARAM_OR_FAIL_V(shape_query, p_shape_query, Dictionary());
+	ERR_FAIL_COND_V_MSG(p_max_results <= 0, Dictionary(), "The maximum amount of results per shape must be greater than 0.");
+
+	const PS3DT::ShapeParameters &parameters = shape_query->get_parameters();
+	const int count = p_origins.size();
+
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+	Transform3D *transforms_ptrw = transforms.ptrw();
+	const Vector3 *origins_ptr = p_origins.ptr();
+	for (int i = 0; i < count; i++) {
+		transforms_ptrw[i] = Transform3D(parameters.transform.basis, origins_ptr[i]);
+	}
+
+	Vector<PS3DT::ShapeResult> results;
+	results.resize(count * p_max_results);
+	PackedInt32Array result_counts;
+	result_counts.resize(count);
+
+	intersect_shapes_batch(parameters, transforms.ptr(), count, results.ptrw(), p_max_results, result_counts.ptrw());
+
+	PackedInt64Array collider_ids;
+	collider_ids.resize(count * p_max_results);
+	PackedInt32Array shapes;
+	shapes.resize(count * p_max_results);
+
+	int64_t *collider_ids_ptrw = collider_ids.ptrw();
+	int32_t *shapes_ptrw = shapes.ptrw();
+	const PS3DT::ShapeResult *results_ptr = results.ptr();
+	const int32_t *result_counts_ptr = result_counts.ptr();
+
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < p_max_results; j++) {
+			const int index = i * p_max_results + j;
+			if (j < result_counts_ptr[i]) {
+				collider_ids_ptrw[index] = int64_t(results_ptr[index].collider_id);
+				shapes_ptrw[index] = results_ptr[index].shape;
+			} else {
+				collider_ids_ptrw[index] = 0;
+				shapes_ptrw[index] = -1;
+			}
+		}
+	}
+
+	Dictionary d;
+	d["count"] = result_counts;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+struct PhysicsDirectSpaceState3D::RayBatch {
+	PhysicsDirectSpaceState3D *state = nullptr;
+	const PS3DT::RayParameters *parameters = nullptr;
+	const Vector3 *from = nullptr;
+	const Vector3 *to = nullptr;
+	const uint32_t *collision_masks = nullptr;
+	PS3DT::RayResult *results = nullptr;
+	bool *hits = nullptr;
+};
+
+struct PhysicsDirectSpaceState3D::ShapeBatch {
+	PhysicsDirectSpaceState3D *state = nullptr;
+	const PS3DT::ShapeParameters *parameters = nullptr;
+	const Transform3D *transforms = nullptr;
+	PS3DT::ShapeResult *results = nullptr;
+	int result_max = 0;
+	int *result_counts = nullptr;
+};
+
+void PhysicsDirectSpaceState3D::_intersect_rays_range(void *p_batch, int p_from, int p_to) {
+	const RayBatch *batch = static_cast<const RayBatch *>(p_batch);
+
+	// One copy per range, so the exclusion set isn't copied for every ray.
+	PS3DT::RayParameters parameters = *batch->parameters;
+	for (int i = p_from; i < p_to; i++) {
+		parameters.from = batch->from[i];
+		parameters.to = batch->to[i];
+		if (batch->collision_masks) {
+			parameters.collision_mask = batch->collision_masks[i];
+		}
+		batch->hits[i] = batch->state->intersect_ray(parameters, batch->results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::_intersect_shapes_range(void *p_batch, int p_from, int p_to) {
+	const ShapeBatch *batch = static_cast<const ShapeBatch *>(p_batch);
+
+	PS3DT::ShapeParameters parameters = *batch->parameters;
+	for (int i = p_from; i < p_to; i++) {
+		parameters.transform = batch->transforms[i];
+		batch->result_counts[i] = batch->state->intersect_shape(parameters, batch->results + i * batch->result_max, batch->result_max);
+	}
+}
+
+void PhysicsDirectSpaceState3D::_process_batch_chunk(uint32_t p_index, BatchJob *p_job) {
+	const int from = int64_t(p_job->count) * p_index / p_job->chunks;
+	const int to = int64_t(p_job->count) * (p_index + 1) / p_job->chunks;
+
+	_batch_queries_begin();
+	p_job->func(p_job->batch, from, to);
+	_batch_queries_end();
+}
+
+void PhysicsDirectSpaceState3D::_process_batch(int p_count, void (*p_func)(void *, int, int), void *p_batch) {
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	if (p_count < BATCH_PARALLEL_MIN_QUERIES || !_is_batch_parallel_safe() || !wtp || wtp->get_thread_count() < 2 || wtp->get_thread_index() != -1) {
+		p_func(p_batch, 0, p_count);
+		return;
+	}
+
+	BatchJob job;
+	job.func = p_func;
+	job.batch = p_batch;
+	job.count = p_count;
+	job.chunks = MIN(p_count / (BATCH_PARALLEL_MIN_QUERIES / 2), wtp->get_thread_count() * 4);
+
+	WorkerThreadPool::GroupID group_task = wtp->add_template_group_task(this, &PhysicsDirectSpaceState3D::_process_batch_chunk, &job, job.chunks, -1, true, SNAME("PhysicsDirectSpaceState3DBatch"));
+	wtp->wait_for_group_task_completion(group_task);
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays_batch(const PS3DT::RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, const uint32_t *p_collision_masks, int p_count, PS3DT::RayResult *r_results, bool *r_hits) {
+	if (p_count <= 0) {
+		return;
+	}
+
+	RayBatch batch;
+	batch.state = this;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.collision_masks = p_collision_masks;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	_process_batch(p_count, &PhysicsDirectSpaceState3D::_intersect_rays_range, &batch);
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes_batch(const PS3DT::ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, PS3DT::ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	if (p_count <= 0) {
+		return;
+	}
+
+	ShapeBatch batch;
+	batch.state = this;
+	batch.parameters = &p_parameters;
+	batch.transforms = p_transforms;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+
+	_process_batch(p_count, &PhysicsDirectSpaceState3D::_intersect_shapes_range, &batch);
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -164,4 +385,6 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays_batch", "parameters", "from", "to", "collision_masks"), &PhysicsDirectSpaceState3D::_intersect_rays_batch, DEFVAL(PackedInt32Array()));
+	ClassDB::bind_method(D_METHOD("intersect_shapes_batch", "parameters", "origins", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes_batch, DEFVAL(8));
 }
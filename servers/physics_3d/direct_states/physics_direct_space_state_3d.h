@@ -46,10 +46,34 @@ private:
 	Vector<real_t> _cast_motion(RequiredParam<PhysicsShapeQueryParameters3D> p_shape_query);
 	TypedArray<Vector3> _collide_shape(RequiredParam<PhysicsShapeQueryParameters3D> p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(RequiredParam<PhysicsShapeQueryParameters3D> p_shape_query);
+	Dictionary _intersect_rays_batch(RequiredParam<PhysicsRayQueryParameters3D> p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to, const PackedInt32Array &p_collision_masks);
+	Dictionary _intersect_shapes_batch(RequiredParam<PhysicsShapeQueryParameters3D> p_shape_query, const PackedVector3Array &p_origins, int p_max_results = 8);
+
+	struct RayBatch;
+	struct ShapeBatch;
+
+	static void _intersect_rays_range(void *p_batch, int p_from, int p_to);
+	static void _intersect_shapes_range(void *p_batch, int p_from, int p_to);
+
+	struct BatchJob {
+		void (*func)(void *, int, int) = nullptr;
+		void *batch = nullptr;
+		int count = 0;
+		int chunks = 0;
+	};
+
+	void _process_batch_chunk(uint32_t p_index, BatchJob *p_job);
+	void _process_batch(int p_count, void (*p_func)(void *, int, int), void *p_batch);
 
 protected:
 	static void _bind_methods();
 
+	// When true, batched queries are spread over the WorkerThreadPool, so the query methods must be safe to call concurrently.
+	virtual bool _is_batch_parallel_safe() const { return false; }
+	// Called on each worker thread around the range of batched queries it runs, e.g. to set up scratch buffers.
+	virtual void _batch_queries_begin() {}
+	virtual void _batch_queries_end() {}
+
 public:
 	virtual bool intersect_ray(const PS3DT::RayParameters &p_parameters, PS3DT::RayResult &r_result) = 0;
 
@@ -62,5 +86,11 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Batched queries. The shared settings come from `p_parameters`, whose own `from`/`to` (or `transform`) are ignored.
+	// `p_collision_masks` can be null to use `p_parameters.collision_mask` for every ray.
+	virtual void intersect_rays_batch(const PS3DT::RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, const uint32_t *p_collision_masks, int p_count, PS3DT::RayResult *r_results, bool *r_hits);
+	// Results of the `i`-th shape are written from `r_results[i * p_result_max]`, their amount in `r_result_counts[i]`.
+	virtual void intersect_shapes_batch(const PS3DT::ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, PS3DT::ShapeResult *r_results, int p_result_max, int *r_result_counts);
+
 	PhysicsDirectSpaceState3D();
 };
@@ -105,6 +105,9 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
+	ClassDB::bind_method(D_METHOD("space_shift_origin", "space", "offset"), &PhysicsServer3D::space_shift_origin);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -222,6 +225,9 @@ void PhysicsServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("body_set_force_integration_callback", "body", "callable", "userdata"), &PhysicsServer3D::body_set_force_integration_callback, DEFVAL(Variant()));
 
+	ClassDB::bind_method(D_METHOD("body_set_render_instance", "body", "instance"), &PhysicsServer3D::body_set_render_instance);
+	ClassDB::bind_method(D_METHOD("body_set_render_multimesh", "body", "multimesh", "index"), &PhysicsServer3D::body_set_render_multimesh);
+
 	ClassDB::bind_method(D_METHOD("body_set_ray_pickable", "body", "enable"), &PhysicsServer3D::body_set_ray_pickable);
 
 	ClassDB::bind_method(D_METHOD("body_test_motion", "body", "parameters", "result"), &PhysicsServer3D::_body_test_motion, DEFVAL(Variant()));
@@ -506,6 +512,7 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(PS3DE::INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(PS3DE::INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PS3DE::INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(PS3DE::INFO_BROADPHASE_TIME);
 
 	BIND_ENUM_CONSTANT(PS3DE::SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(PS3DE::SPACE_PARAM_CONTACT_MAX_SEPARATION);
@@ -526,6 +533,26 @@ void PhysicsServer3D::_bind_methods() {
 #endif
 }
 
+Vector<uint8_t> PhysicsServer3D::space_save_state(RID p_space) const {
+	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Saving space state is not supported by this physics server.");
+}
+
+bool PhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	ERR_FAIL_V_MSG(false, "Restoring space state is not supported by this physics server.");
+}
+
+void PhysicsServer3D::space_shift_origin(RID p_space, const Vector3 &p_offset) {
+	ERR_FAIL_MSG("Shifting the space origin is not supported by this physics server.");
+}
+
+void PhysicsServer3D::body_set_render_instance(RID p_body, RID p_instance) {
+	ERR_FAIL_MSG("Writing body transforms to the rendering server is not supported by this physics server.");
+}
+
+void PhysicsServer3D::body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index) {
+	ERR_FAIL_MSG("Writing body transforms to the rendering server is not supported by this physics server.");
+}
+
 PhysicsServer3D::PhysicsServer3D() {
 	singleton = this;
 
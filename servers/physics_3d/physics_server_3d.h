@@ -101,6 +101,13 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshots of the simulated body state, for rollback. Not every server supports them.
+	virtual Vector<uint8_t> space_save_state(RID p_space) const;
+	virtual bool space_restore_state(RID p_space, const Vector<uint8_t> &p_state);
+
+	// Moves everything in the space by `-p_offset`, to keep simulated objects close to the origin in large worlds. Not every server supports it.
+	virtual void space_shift_origin(RID p_space, const Vector3 &p_offset);
+
 	//missing space parameters
 
 	/* AREA API */
@@ -243,6 +250,10 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) = 0;
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) = 0;
 
+	// Writes the body transform straight to the rendering server whenever the body moves, bypassing the scene. Not every server supports this.
+	virtual void body_set_render_instance(RID p_body, RID p_instance);
+	virtual void body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index);
+
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) = 0;
 
 	// this function only works on physics process, errors and returns null otherwise
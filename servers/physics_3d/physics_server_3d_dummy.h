@@ -171,6 +171,9 @@ public:
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override {}
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override { return Vector<Vector3>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
+	virtual Vector<uint8_t> space_save_state(RID p_space) const override { return Vector<uint8_t>(); }
+	virtual bool space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override { return false; }
+	virtual void space_shift_origin(RID p_space, const Vector3 &p_offset) override {}
 
 	/* AREA API */
 
@@ -302,6 +305,9 @@ public:
 	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override {}
 	virtual void body_set_force_integration_callback(RID p_body, const Callable &p_callable, const Variant &p_udata = Variant()) override {}
 
+	virtual void body_set_render_instance(RID p_body, RID p_instance) override {}
+	virtual void body_set_render_multimesh(RID p_body, RID p_multimesh, int p_index) override {}
+
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override {}
 
 	virtual PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override { return body_state_dummy; }
@@ -256,7 +256,8 @@ enum AreaBodyStatus {
 enum ProcessInfo {
 	INFO_ACTIVE_OBJECTS,
 	INFO_COLLISION_PAIRS,
-	INFO_ISLAND_COUNT
+	INFO_ISLAND_COUNT,
+	INFO_BROADPHASE_TIME
 };
 
 #ifndef DISABLE_DEPRECATED
@@ -134,6 +134,10 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(Vector<uint8_t>, space_save_state, RID);
+	FUNC2R(bool, space_restore_state, RID, const Vector<uint8_t> &);
+	FUNC2(space_shift_origin, RID, const Vector3 &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -268,6 +272,9 @@ public:
 	FUNC2(body_set_state_sync_callback, RID, const Callable &);
 	FUNC3(body_set_force_integration_callback, RID, const Callable &, const Variant &);
 
+	FUNC2(body_set_render_instance, RID, RID);
+	FUNC3(body_set_render_multimesh, RID, RID, int);
+
 	FUNC2(body_set_ray_pickable, RID, bool);
 
 	bool body_test_motion(RID p_body, const PS3DT::MotionParameters &p_parameters, PS3DT::MotionResult *r_result = nullptr) override {
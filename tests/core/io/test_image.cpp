@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_image)
 
 #include "core/io/file_access.h"
 #include "core/io/image.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/test_utils.h"
 
 #include "modules/modules_enabled.gen.h" // For bmp, jpg, svg, webp, tga, exr.
@@ -264,6 +265,82 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+struct ImageResizeJob {
+	Ref<Image> image;
+	int width = 0;
+	int height = 0;
+	Image::Interpolation interpolation = Image::INTERPOLATE_NEAREST;
+
+	static void resize(void *p_userdata) {
+		ImageResizeJob *job = static_cast<ImageResizeJob *>(p_userdata);
+		job->image->resize(job->width, job->height, job->interpolation);
+	}
+};
+
+TEST_CASE("[Image] Multithreaded resizing and mipmaps are bit-exact") {
+	Ref<Image> source = memnew(Image(320, 256, false, Image::FORMAT_RGBA8));
+	for (int y = 0; y < source->get_height(); y++) {
+		for (int x = 0; x < source->get_width(); x++) {
+			source->set_pixel(x, y, Color((x * 7 % 256) / 255.0, (y * 13 % 256) / 255.0, ((x ^ y) % 256) / 255.0, ((x + y) % 256) / 255.0));
+		}
+	}
+
+	for (int i = 0; i < 5; i++) {
+		Image::Interpolation interpolation = static_cast<Image::Interpolation>(i);
+
+		// Resizing from a pool thread processes every row inline, which gives a serial reference.
+		ImageResizeJob job;
+		job.image.instantiate();
+		job.image->copy_internals_from(source);
+		job.width = 500;
+		job.height = 300;
+		job.interpolation = interpolation;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(&ImageResizeJob::resize, &job);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+
+		Ref<Image> image = memnew(Image);
+		image->copy_internals_from(source);
+		image->resize(500, 300, interpolation);
+
+		CHECK_MESSAGE(
+				image->get_data() == job.image->get_data(),
+				vformat("Resizing with interpolation %d should give the same result when split across threads.", i));
+	}
+
+	Ref<Image> mipmapped = memnew(Image);
+	mipmapped->copy_internals_from(source);
+	mipmapped->generate_mipmaps();
+	const Vector<uint8_t> source_data = source->get_data();
+	const Vector<uint8_t> mipmap_data = mipmapped->get_image_from_mipmap(1)->get_data();
+	const int src_width = source->get_width();
+	const int dst_width = src_width / 2;
+	for (int y = 0; y < source->get_height() / 2; y++) {
+		for (int x = 0; x < dst_width; x++) {
+			for (int c = 0; c < 4; c++) {
+				const int up = ((y * 2) * src_width + x * 2) * 4 + c;
+				const int down = up + src_width * 4;
+				const uint8_t expected = (source_data[up] + source_data[up + 4] + source_data[down] + source_data[down + 4] + 2) >> 2;
+				if (mipmap_data[(y * dst_width + x) * 4 + c] != expected) {
+					FAIL(vformat("Mipmap pixel (%d, %d) does not match the average of its source pixels.", x, y));
+				}
+			}
+		}
+	}
+
+	Ref<Image> premultiplied = memnew(Image);
+	premultiplied->copy_internals_from(source);
+	premultiplied->premultiply_alpha();
+	const Vector<uint8_t> premultiplied_data = premultiplied->get_data();
+	for (int i = 0; i < source_data.size(); i += 4) {
+		for (int c = 0; c < 3; c++) {
+			const uint8_t expected = (uint16_t(source_data[i + c]) * uint16_t(source_data[i + 3]) + 255U) >> 8;
+			if (premultiplied_data[i + c] != expected) {
+				FAIL(vformat("Premultiplied pixel %d does not match its source pixel.", i / 4));
+			}
+		}
+	}
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
@@ -36,6 +36,7 @@ TEST_FORCE_LINK(test_object)
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/signal_watcher.h"
 
 namespace TestObject {
@@ -203,6 +204,53 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+static SafeNumeric<uint32_t> objectdb_test_failures;
+
+static void objectdb_create_destroy_test(void *p_userdata, uint32_t p_index) {
+	constexpr int OBJECTS = 256;
+	Object *objects[OBJECTS];
+	ObjectID ids[OBJECTS];
+
+	for (int round = 0; round < 8; round++) {
+		for (int i = 0; i < OBJECTS; i++) {
+			objects[i] = memnew(Object);
+			ids[i] = objects[i]->get_instance_id();
+		}
+		for (int i = 0; i < OBJECTS; i++) {
+			if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+				objectdb_test_failures.increment();
+			}
+		}
+		// Free in a different order than allocated, so slots get shuffled between threads.
+		for (int i = 0; i < OBJECTS; i += 2) {
+			memdelete(objects[i]);
+		}
+		for (int i = 1; i < OBJECTS; i += 2) {
+			memdelete(objects[i]);
+		}
+		for (int i = 0; i < OBJECTS; i++) {
+			if (ObjectDB::get_instance(ids[i]) != nullptr) {
+				objectdb_test_failures.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB concurrent creation and destruction") {
+	const int object_count = ObjectDB::get_object_count();
+	objectdb_test_failures.set(0);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(objectdb_create_destroy_test, nullptr, 64, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(
+			objectdb_test_failures.get() == 0,
+			"Object IDs should resolve to their own object while alive, and to null once freed.");
+	CHECK_MESSAGE(
+			ObjectDB::get_object_count() == object_count,
+			"All objects created by the tasks should be gone from the ObjectDB.");
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object *object = memnew(Object);
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
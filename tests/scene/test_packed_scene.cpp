@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_packed_scene)
 
 #include "core/object/callable_mp.h"
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 namespace TestPackedScene {
@@ -216,6 +217,49 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene In Batch") {
+	// Create a scene to pack, with properties that need to be restored on instantiation.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+	scene->set_z_index(3);
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(1.5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate several copies at once.
+	TypedArray<Node> instances = packed_scene.instantiate_batch(3);
+	CHECK(instances.size() == 3);
+
+	for (int i = 0; i < instances.size(); i++) {
+		Node2D *instance = Object::cast_to<Node2D>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_position() == Vector2(10, 20));
+		CHECK(instance->get_z_index() == 3);
+
+		REQUIRE(instance->get_child_count() == 1);
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_owner() == instance);
+		CHECK(instance_child->get_rotation() == doctest::Approx(1.5));
+
+		memdelete(instance);
+	}
+
+	// A count of zero is valid and creates nothing.
+	CHECK(packed_scene.instantiate_batch(0).is_empty());
+
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -0,0 +1,178 @@
+/**************************************************************************/
+/*  test_scene_pool.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_scene_pool)
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_pool.h"
+
+namespace TestScenePool {
+
+static Ref<PackedScene> _create_packed_scene() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(1.5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	return packed_scene;
+}
+
+TEST_CASE("[ScenePool] Acquire and release") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node *first = pool->acquire();
+	REQUIRE(first != nullptr);
+	CHECK(pool->get_miss_count() == 1);
+	CHECK(pool->get_hit_count() == 0);
+	CHECK(pool->get_in_use_count() == 1);
+
+	pool->release(first);
+	CHECK(pool->get_available_count() == 1);
+	CHECK(pool->get_in_use_count() == 0);
+
+	Node *second = pool->acquire();
+	CHECK(second == first);
+	CHECK(pool->get_hit_count() == 1);
+	CHECK(pool->get_miss_count() == 1);
+	CHECK(pool->get_available_count() == 0);
+
+	ERR_PRINT_OFF;
+	Node *foreign = memnew(Node);
+	pool->release(foreign);
+	CHECK_MESSAGE(pool->get_available_count() == 0, "Nodes not acquired from the pool should be rejected.");
+	memdelete(foreign);
+	ERR_PRINT_ON;
+
+	pool->release(second);
+}
+
+TEST_CASE("[ScenePool] Released nodes are reset to their packed state") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node2D *node = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(node != nullptr);
+	Node2D *child = Object::cast_to<Node2D>(node->get_node(NodePath("Child")));
+	REQUIRE(child != nullptr);
+
+	Node *parent = memnew(Node);
+	parent->add_child(node);
+	node->set_position(Vector2(100, 200));
+	child->set_rotation(0.25);
+
+	pool->release(node);
+	CHECK(node->get_parent() == nullptr);
+	CHECK(parent->get_child_count() == 0);
+	CHECK(node->get_position() == Vector2(10, 20));
+	CHECK(child->get_rotation() == doctest::Approx(1.5));
+
+	memdelete(parent);
+}
+
+TEST_CASE("[ScenePool] Released nodes drop runtime changes that are not in the packed state") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node2D *node = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(node != nullptr);
+	Node2D *child = Object::cast_to<Node2D>(node->get_node(NodePath("Child")));
+	REQUIRE(child != nullptr);
+
+	// Properties left at their default when packed.
+	child->set_position(Vector2(5, 5));
+	child->set_visible(false);
+	node->set_meta("hit_count", 3);
+
+	Node *added = memnew(Node);
+	added->set_name("Added");
+	node->add_child(added);
+	node->add_to_group("enemies");
+
+	pool->release(node);
+	CHECK(child->get_position() == Vector2());
+	CHECK(child->is_visible());
+	CHECK_FALSE(node->has_meta("hit_count"));
+	CHECK(node->get_child_count() == 1);
+	CHECK(node->get_node_or_null(NodePath("Added")) == nullptr);
+	CHECK_FALSE(node->is_in_group("enemies"));
+
+	pool->clear();
+}
+
+TEST_CASE("[ScenePool] Freed instances are no longer in use") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node *node = pool->acquire();
+	REQUIRE(node != nullptr);
+	CHECK(pool->get_in_use_count() == 1);
+
+	memdelete(node);
+	CHECK(pool->get_in_use_count() == 0);
+
+	Node *other = pool->acquire();
+	CHECK(pool->get_in_use_count() == 1);
+	memdelete(other);
+}
+
+TEST_CASE("[ScenePool] Prewarm and size limit") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+	pool->set_max_size(4);
+
+	pool->prewarm(8);
+	CHECK(pool->get_available_count() == 4);
+
+	pool->set_max_size(2);
+	CHECK(pool->get_available_count() == 2);
+
+	pool->clear();
+	CHECK(pool->get_available_count() == 0);
+}
+
+} // namespace TestScenePool
@@ -36,7 +36,11 @@ TEST_FORCE_LINK(test_navigation_server_3d)
 
 #ifdef MODULE_NAVIGATION_3D_ENABLED
 
+#include "core/config/project_settings.h"
 #include "core/object/callable_mp.h"
+#include "core/os/os.h"
+#include "modules/navigation_3d/3d/nav_map_builder_3d.h"
+#include "modules/navigation_3d/3d/nav_mesh_generator_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/window.h"
@@ -47,6 +51,7 @@ TEST_FORCE_LINK(test_navigation_server_3d)
 #include "servers/navigation_3d/navigation_path_query_result_3d.h"
 #include "servers/navigation_3d/navigation_server_3d.h"
 #include "tests/signal_watcher.h"
+#include "tests/test_tools.h"
 
 namespace TestNavigationServer3D {
 
@@ -64,6 +69,54 @@ public:
 	Variant function1_latest_arg0;
 };
 
+// Bakes a flat 10 x 10 box centered on the origin. Without agent radius the polygons reach the box edges,
+// so regions placed 10.5 apart leave a gap of 0.5 between them.
+// The box is added to `p_source_geometry` when given, so that the caller can edit the geometry and bake it again.
+static Ref<NavigationMesh> _bake_test_box_navmesh(real_t p_edge_max_length = 0.0, real_t p_tile_size = 0.0, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry = Ref<NavigationMeshSourceGeometryData3D>()) {
+	Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+	navigation_mesh->set_agent_radius(0.0);
+	navigation_mesh->set_edge_max_length(p_edge_max_length);
+	navigation_mesh->set_tile_size(p_tile_size);
+	if (p_source_geometry.is_null()) {
+		p_source_geometry.instantiate();
+	}
+
+	Array arr;
+	arr.resize(RSE::ARRAY_MAX);
+	BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+	p_source_geometry->add_mesh_array(arr, Transform3D());
+	NavigationServer3D::get_singleton()->bake_from_source_geometry_data(navigation_mesh, p_source_geometry, Callable());
+	CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+	return navigation_mesh;
+}
+
+// Creates an active map that builds on the calling thread, with a region of the navigation mesh at each position.
+static RID _create_test_map_with_regions(const Ref<NavigationMesh> &p_navigation_mesh, const LocalVector<Vector3> &p_region_positions, LocalVector<RID> &r_regions) {
+	NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+	RID map = navigation_server->map_create();
+	navigation_server->map_set_active(map, true);
+	navigation_server->map_set_use_async_iterations(map, false);
+	navigation_server->map_set_edge_connection_margin(map, 1.0);
+	for (const Vector3 &region_position : p_region_positions) {
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_transform(region, Transform3D(Basis(), region_position));
+		navigation_server->region_set_navigation_mesh(region, p_navigation_mesh);
+		r_regions.push_back(region);
+	}
+	return map;
+}
+
+static void _free_test_map(RID p_map, const LocalVector<RID> &p_regions) {
+	NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+	for (const RID &region : p_regions) {
+		navigation_server->free_rid(region);
+	}
+	navigation_server->free_rid(p_map);
+	navigation_server->physics_process(0.0); // Give server some cycles to commit.
+}
+
 TEST_SUITE("[Navigation3D]") {
 	TEST_CASE("[NavigationServer3D] Server should be empty when initialized") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -712,6 +765,13 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_NE(navigation_server->map_get_path(map, Vector3(0, 0, 0), Vector3(10, 0, 10), false).size(), 0);
 		}
 
+		SUBCASE("Flow direction should point towards the target") {
+			const Vector3 direction = navigation_server->map_get_flow_direction(map, Vector3(-4, 0, -4), Vector3(4, 0, 4));
+			CHECK(direction.is_normalized());
+			CHECK_GT(direction.dot(Vector3(1, 0, 1)), 0.0);
+			CHECK(navigation_server->map_get_flow_direction(map, Vector3(-4, 0, -4), Vector3(4, 0, 4)).is_equal_approx(direction));
+		}
+
 		SUBCASE("'map_get_closest_point_to_segment' with 'use_collision' should return default if segment doesn't intersect map") {
 			CHECK_EQ(navigation_server->map_get_closest_point_to_segment(map, Vector3(1, 2, 1), Vector3(1, 1, 1), true), Vector3());
 		}
@@ -730,6 +790,20 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_NE(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Async query should yield non-empty result after processing") {
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(0, 0, 0));
+			query_parameters->set_target_position(Vector3(10, 0, 10));
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path_async(query_parameters, query_result);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_PENDING_COUNT), 1);
+			CHECK_EQ(query_result->get_path().size(), 0);
+			navigation_server->process(0.0); // Give server some cycles to process the query.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_PENDING_COUNT), 0);
+			CHECK_NE(query_result->get_path().size(), 0);
+		}
+
 		SUBCASE("Elaborate query with 'EDGECENTERED' post-processing should yield non-empty result") {
 			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
 			query_parameters->set_map(map);
@@ -817,6 +891,440 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should finish async queries of freed maps") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(0, 0, 0));
+		query_parameters->set_target_position(Vector3(10, 0, 10));
+		Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+		query_result->set_path(Vector<Vector3>({ Vector3(1, 2, 3) }));
+		CallableMock callback_mock;
+		navigation_server->query_path_async(query_parameters, query_result, callable_mp(&callback_mock, &CallableMock::function1).bind(Variant()));
+
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		navigation_server->process(0.0); // Give server some cycles to process the query.
+
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_PENDING_COUNT), 0);
+		CHECK_EQ(callback_mock.function1_calls, 1);
+		CHECK_EQ(query_result->get_path().size(), 0);
+	}
+
+	TEST_CASE("[NavigationServer3D] Flow fields should cross edge connections and stop at unreachable targets") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+
+		// Two regions joined by edge connections across a gap, and one that is not connected to them.
+		LocalVector<RID> regions;
+		RID map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10.5, 0, 0), Vector3(0, 0, 30) }, regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		REQUIRE_GT(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+
+		const Vector3 target_position(14, 0, 2);
+
+		// The field leads out of the first region through the connection pathways towards the second one.
+		const Vector3 crossing_direction = navigation_server->map_get_flow_direction(map, Vector3(-4, 0, 2), target_position);
+		CHECK(crossing_direction.is_normalized());
+		CHECK_GT(crossing_direction.dot(Vector3(1, 0, 0)), 0.9);
+
+		const Vector3 target_region_direction = navigation_server->map_get_flow_direction(map, Vector3(12, 0, 2), target_position);
+		CHECK_GT(target_region_direction.dot(Vector3(1, 0, 0)), 0.9);
+
+		// Samples on the unconnected region can't reach the target, even though the field is already built.
+		CHECK_EQ(navigation_server->map_get_flow_direction(map, Vector3(0, 0, 30), target_position), Vector3());
+		CHECK_EQ(navigation_server->map_get_flow_direction(map, Vector3(-4, 0, 2), Vector3(0, 0, 30)), Vector3());
+		CHECK(navigation_server->map_get_flow_direction(map, Vector3(-4, 0, 2), target_position).is_equal_approx(crossing_direction));
+
+		_free_test_map(map, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical path queries should match A* across multiple regions") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+		const int region_polygon_count = navigation_mesh->get_polygon_count();
+
+		// The path goes from the start region through the next one and turns into the end region.
+		// Three dead-end regions on the other side of the start region are connected but not on the way.
+		// They cost nothing to travel, so the plain polygon search explores all of them before moving on.
+		LocalVector<RID> regions;
+		RID map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10, 0, 0), Vector3(10, 0, 10), Vector3(-10, 0, 0), Vector3(-20, 0, 0), Vector3(-30, 0, 0) }, regions);
+		for (uint32_t i = 3; i < regions.size(); i++) {
+			navigation_server->region_set_travel_cost(regions[i], 0.0);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(-4, 0, -4));
+		query_parameters->set_target_position(Vector3(6, 0, 14));
+
+		Ref<NavigationPathQueryResult3D> astar_result;
+		astar_result.instantiate();
+		navigation_server->query_path(query_parameters, astar_result);
+		REQUIRE_NE(astar_result->get_path().size(), 0);
+		const Vector3 astar_end = astar_result->get_path()[astar_result->get_path().size() - 1];
+		CHECK(astar_end.is_equal_approx(Vector3(6, 0, 14)));
+
+		// The search restricted to the three clusters on the abstract path never needs this many polygons.
+		// The regular search runs out of them in the dead ends, and so would the fallback.
+		query_parameters->set_path_search_max_polygons(region_polygon_count * 3);
+		Ref<NavigationPathQueryResult3D> limited_astar_result;
+		limited_astar_result.instantiate();
+		navigation_server->query_path(query_parameters, limited_astar_result);
+		REQUIRE_NE(limited_astar_result->get_path().size(), 0);
+		CHECK_FALSE(limited_astar_result->get_path()[limited_astar_result->get_path().size() - 1].is_equal_approx(astar_end));
+
+		query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+		Ref<NavigationPathQueryResult3D> hierarchical_result;
+		hierarchical_result.instantiate();
+		navigation_server->query_path(query_parameters, hierarchical_result);
+
+		REQUIRE_NE(hierarchical_result->get_path().size(), 0);
+		CHECK(hierarchical_result->get_path()[0].is_equal_approx(astar_result->get_path()[0]));
+		CHECK(hierarchical_result->get_path()[hierarchical_result->get_path().size() - 1].is_equal_approx(astar_end));
+		CHECK_EQ(hierarchical_result->get_path_length(), doctest::Approx(astar_result->get_path_length()));
+		CHECK(hierarchical_result->get_path_owner_ids() == astar_result->get_path_owner_ids());
+
+		_free_test_map(map, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should keep edge connection margin connections of unchanged regions") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+
+		// Two regions with a gap between them that is smaller than the margin, and one far away from both.
+		LocalVector<RID> regions;
+		RID map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10.5, 0, 0), Vector3(0, 0, 30) }, regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const int edge_connection_count = navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
+		CHECK_GT(edge_connection_count, 0);
+
+		const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, 0), Vector3(14, 0, 0), true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(Vector3(14, 0, 0)));
+
+		SUBCASE("Moving an unrelated region should keep the connections") {
+			const uint64_t built_region_pair_count = NavMapBuilder3D::get_built_region_pair_count();
+			navigation_server->region_set_transform(regions[2], Transform3D(Basis(), Vector3(0, 0, 40)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+			// The pairs of the two near regions are reused from the previous build.
+			CHECK_EQ(NavMapBuilder3D::get_built_region_pair_count(), built_region_pair_count);
+		}
+
+		SUBCASE("Moving a region within the margin should rebuild only its pairs") {
+			const uint64_t built_region_pair_count = NavMapBuilder3D::get_built_region_pair_count();
+			navigation_server->region_set_transform(regions[1], Transform3D(Basis(), Vector3(10.25, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_GT(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+			// One pair in each direction.
+			CHECK_EQ(NavMapBuilder3D::get_built_region_pair_count() - built_region_pair_count, 2);
+		}
+
+		SUBCASE("Moving a region out of the margin should drop its connections") {
+			navigation_server->region_set_transform(regions[1], Transform3D(Basis(), Vector3(13, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+		}
+
+		_free_test_map(map, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should connect regions of large maps the same as of small maps") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		// Short edges give every region enough free edges to build the large map on worker threads.
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh(1.0);
+
+		// Regions in a row with a gap between neighbors that is smaller than the margin.
+		const int region_count = 128;
+		LocalVector<Vector3> region_positions;
+		for (int i = 0; i < region_count; i++) {
+			region_positions.push_back(Vector3(i * 10.5, 0, 0));
+		}
+
+		// Two regions stay below the thresholds for worker tasks, so they are connected on the calling thread.
+		LocalVector<RID> small_map_regions;
+		RID small_map = _create_test_map_with_regions(navigation_mesh, { region_positions[0], region_positions[1] }, small_map_regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const int pair_edge_connection_count = navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
+		CHECK_GT(pair_edge_connection_count, 0);
+		_free_test_map(small_map, small_map_regions);
+
+		// Every neighbor pair of the row is a translated copy of the two region map.
+		LocalVector<RID> large_map_regions;
+		RID large_map = _create_test_map_with_regions(navigation_mesh, region_positions, large_map_regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		REQUIRE_GE(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT), 4096);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), (region_count - 1) * pair_edge_connection_count);
+
+		const Vector3 target = Vector3((region_count - 1) * 10.5 + 4.0, 0, 0);
+		const Vector<Vector3> path = navigation_server->map_get_path(large_map, Vector3(-4, 0, 0), target, true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(target));
+
+		_free_test_map(large_map, large_map_regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should load map connections from connection data") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+
+		LocalVector<RID> regions;
+		RID map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10.5, 0, 0) }, regions);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const int edge_connection_count = navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
+		CHECK_GT(edge_connection_count, 0);
+
+		const Vector<uint8_t> connection_data = navigation_server->map_get_connection_data(map);
+		CHECK_FALSE(connection_data.is_empty());
+		navigation_server->map_set_active(map, false);
+
+		LocalVector<RID> loaded_map_regions;
+		RID loaded_map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10.5, 0, 0) }, loaded_map_regions);
+		const RID moved_region = loaded_map_regions[1];
+
+		SUBCASE("Matching data should be loaded") {
+			navigation_server->map_set_connection_data(loaded_map, connection_data);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+			CHECK_EQ(navigation_server->map_get_connection_data(loaded_map), connection_data);
+
+			const Vector<Vector3> path = navigation_server->map_get_path(loaded_map, Vector3(-4, 0, 0), Vector3(14, 0, 0), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(14, 0, 0)));
+		}
+
+		SUBCASE("Data of a different map should be kept until it matches and discarded once loaded") {
+			navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.25, 0, 0)));
+			navigation_server->map_set_connection_data(loaded_map, connection_data);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 0);
+			CHECK_GT(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+
+			// Moving the region back matches the data again.
+			navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.5, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+
+			// The loaded data is gone, so the next builds connect the regions again.
+			navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.25, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.5, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+		}
+
+		SUBCASE("Data should be kept while regions with async iterations join the map over several syncs") {
+			navigation_server->map_set_active(loaded_map, false);
+			RID async_map = navigation_server->map_create();
+			navigation_server->map_set_active(async_map, true);
+			navigation_server->map_set_use_async_iterations(async_map, false);
+			navigation_server->map_set_edge_connection_margin(async_map, 1.0);
+			navigation_server->map_set_connection_data(async_map, connection_data);
+
+			LocalVector<RID> async_regions;
+			for (const Vector3 &region_position : { Vector3(), Vector3(10.5, 0, 0) }) {
+				RID region = navigation_server->region_create();
+				navigation_server->region_set_use_async_iterations(region, true);
+				navigation_server->region_set_map(region, async_map);
+				navigation_server->region_set_transform(region, Transform3D(Basis(), region_position));
+				navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+				async_regions.push_back(region);
+				navigation_server->physics_process(0.0); // Give server some cycles to commit.
+				if (async_regions.size() == 1) {
+					CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 0);
+				}
+			}
+
+			// The region iterations are built on worker threads and join the map on later syncs.
+			for (int i = 0; i < 1000 && navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT) == 0; i++) {
+				OS::get_singleton()->delay_usec(1000);
+				navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			}
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+
+			_free_test_map(async_map, async_regions);
+		}
+
+		SUBCASE("Truncated or corrupted data should print an error and be discarded") {
+			Vector<uint8_t> corrupted_data = connection_data;
+			corrupted_data.write[corrupted_data.size() / 2] ^= 0xFF;
+			const Vector<uint8_t> invalid_datas[2] = { connection_data.slice(0, connection_data.size() - 4), corrupted_data };
+
+			for (const Vector<uint8_t> &invalid_data : invalid_datas) {
+				ErrorDetector ed;
+				navigation_server->map_set_connection_data(loaded_map, invalid_data);
+				navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.5, 0, 0)));
+				ERR_PRINT_OFF;
+				navigation_server->physics_process(0.0); // Give server some cycles to commit.
+				ERR_PRINT_ON;
+				CHECK(ed.has_error);
+				CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_CONNECTION_DATA_LOAD_COUNT), 0);
+				CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), edge_connection_count);
+
+				// The next build must not read the data again.
+				ed.clear();
+				navigation_server->region_set_transform(moved_region, Transform3D(Basis(), Vector3(10.25, 0, 0)));
+				navigation_server->physics_process(0.0); // Give server some cycles to commit.
+				CHECK_FALSE(ed.has_error);
+			}
+		}
+
+		_free_test_map(loaded_map, loaded_map_regions);
+		_free_test_map(map, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should reuse cached path corridors") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+
+		// Two regions with a gap between them that is smaller than the margin, so that a path crosses several polygons.
+		// The cache size is read when the map is created.
+		const Variant path_corridor_cache_size = ProjectSettings::get_singleton()->get_setting("navigation/pathfinding/path_corridor_cache_size");
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_corridor_cache_size", 16);
+		LocalVector<RID> regions;
+		RID map = _create_test_map_with_regions(navigation_mesh, { Vector3(), Vector3(10.5, 0, 0) }, regions);
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_corridor_cache_size", path_corridor_cache_size);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, 0), Vector3(14, 0, 0), true);
+		const Vector<Vector3> cached_path = navigation_server->map_get_path(map, Vector3(-4, 0, 0), Vector3(14, 0, 0), true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK(path[path.size() - 1].is_equal_approx(Vector3(14, 0, 0)));
+		CHECK_EQ(cached_path, path);
+
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_MISS_COUNT), 1);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_HIT_COUNT), 1);
+
+		SUBCASE("Changing the map should empty the cache") {
+			navigation_server->region_set_transform(regions[1], Transform3D(Basis(), Vector3(10.25, 0, 0)));
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			navigation_server->map_get_path(map, Vector3(-4, 0, 0), Vector3(14, 0, 0), true);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_MISS_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CORRIDOR_CACHE_HIT_COUNT), 0);
+		}
+
+		_free_test_map(map, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should report map memory usage") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh();
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const int64_t empty_map_memory_usage = navigation_server->map_get_memory_usage(map);
+		CHECK_GT(empty_map_memory_usage, 0);
+
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const int64_t map_memory_usage = navigation_server->map_get_memory_usage(map);
+		CHECK_GT(map_memory_usage, empty_map_memory_usage);
+
+		// Path queries set up their data on first use.
+		navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(4, 0, 4), true);
+		CHECK_GT(navigation_server->map_get_memory_usage(map), map_memory_usage);
+
+		// Map builds alternate between two iterations, each with its own path query slots.
+		// A slot keeps its buffers over a build when a query used it since the previous build of the same iteration.
+		const Transform3D region_transforms[2] = { Transform3D(Basis(), Vector3(0, 0, 0.5)), Transform3D() };
+		navigation_server->region_set_transform(region, region_transforms[0]);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(4, 0, 4), true);
+		navigation_server->region_set_transform(region, region_transforms[1]);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		const int64_t kept_map_memory_usage = navigation_server->map_get_memory_usage(map);
+		CHECK_GT(kept_map_memory_usage, map_memory_usage);
+
+		// Without further queries, the next build of the same iteration frees the slot.
+		for (const Transform3D &region_transform : region_transforms) {
+			navigation_server->region_set_transform(region, region_transform);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+		CHECK_LT(navigation_server->map_get_memory_usage(map), kept_map_memory_usage);
+
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation mesh and reuse unchanged tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		// The floor spans from -5 to 5, so it overlaps 4 x 4 tiles of size 4.
+		uint64_t baked_tile_count = NavMeshGenerator3D::get_baked_tile_count();
+		Ref<NavigationMesh> navigation_mesh = _bake_test_box_navmesh(0.0, 4.0, source_geometry);
+		CHECK_EQ(NavMeshGenerator3D::get_baked_tile_count() - baked_tile_count, 16);
+		const int polygon_count = navigation_mesh->get_polygon_count();
+		const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+		CHECK_GT(polygon_count, 2);
+		CHECK_GT(vertices.size(), 4);
+
+		SUBCASE("Rebaking unchanged geometry should reuse all tiles and yield the same navigation mesh") {
+			baked_tile_count = NavMeshGenerator3D::get_baked_tile_count();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_baked_tile_count(), baked_tile_count);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+			CHECK_EQ(navigation_mesh->get_vertices(), vertices);
+		}
+
+		SUBCASE("Editing geometry should only rebake the tiles it touches") {
+			// A box from 2.5 to 3.5 reaches tiles 0 and 1 on both axes with the tile border added.
+			Array box_arr;
+			box_arr.resize(RSE::ARRAY_MAX);
+			BoxMesh::create_mesh_array(box_arr, Vector3(1.0, 1.0, 1.0));
+			source_geometry->add_mesh_array(box_arr, Transform3D(Basis(), Vector3(3.0, 0.5, 3.0)));
+
+			baked_tile_count = NavMeshGenerator3D::get_baked_tile_count();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_baked_tile_count() - baked_tile_count, 4);
+			CHECK_NE(navigation_mesh->get_vertices(), vertices);
+		}
+
+		SUBCASE("Paths should cross tile boundaries") {
+			RID map = navigation_server->map_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->map_set_use_async_iterations(map, false);
+			RID region = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(region, false);
+			// Only the welded tile borders can connect the tiles.
+			navigation_server->region_set_use_edge_connections(region, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			// Crosses the tile boundaries at x = -4, x = 0 and x = 4.
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4.25, 0, -2), Vector3(4.25, 0, -2), true);
+			REQUIRE_NE(path.size(), 0);
+			const Vector3 path_end = path[path.size() - 1];
+			CHECK(Vector2(path_end.x, path_end.z).is_equal_approx(Vector2(4.25, -2)));
+
+			navigation_server->free_rid(region);
+			navigation_server->free_rid(map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {